@@ -0,0 +1,101 @@
+/** ////////////////////////////////////////////////////////////////
+
+    *** Hyper C++ - A simplified C++ experience ***
+
+        Yet (another) open source library for C++
+
+        Original Copyright (C) Damian Tran 2019
+
+        By aiFive Technologies, Inc. for developers
+
+    Copying and redistribution of this code is freely permissible.
+    Inclusion of the above notice is preferred but not required.
+
+    This software is provided AS IS without any expressed or implied
+    warranties.  By using this code, and any modifications and
+    variants arising thereof, you are assuming all liabilities and
+    risks that may be thus associated.
+
+////////////////////////////////////////////////////////////////  **/
+
+#pragma once
+
+#ifndef TOOLKIT_CHAR_SCAN
+#define TOOLKIT_CHAR_SCAN
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#define CHAR_SCAN_BLOCK_SIZE        64      // Bytes described by each mask
+#define CHAR_SCAN_MAX_DELIM         8       // Delimiter characters compared per block
+
+namespace hyperC
+{
+
+/** @brief Bit positions of structural characters within a 64-byte block.
+    Bit i refers to byte i of the block. */
+
+struct char_scan_mask
+{
+    uint64_t delim;
+    uint64_t newline;   // '\n' or '\r'
+    uint64_t quote;     // '"'
+
+    inline uint64_t any() const noexcept{ return delim | newline | quote; }
+};
+
+/** @brief Vectorized scanner for delimited text (AVX2 or SSE2 where the compiler
+    targets them, with a scalar fallback).  Emits one char_scan_mask per block. */
+
+class char_scanner
+{
+protected:
+
+    char            delims[CHAR_SCAN_MAX_DELIM];
+    unsigned int    numDelims;
+
+public:
+
+    // Scan L bytes of data, writing (L + 63)/64 masks to output
+    void scan(const char* data, const size_t& L, char_scan_mask* output) const;
+
+    inline void scan(const char* data, const size_t& L, std::vector<char_scan_mask>& output) const
+    {
+        output.resize((L + CHAR_SCAN_BLOCK_SIZE - 1)/CHAR_SCAN_BLOCK_SIZE);
+        scan(data, L, output.data());
+    }
+
+    inline const unsigned int& size() const noexcept{ return numDelims; }
+
+    char_scanner(const std::string& delim = "\t");
+};
+
+// Count occurrences of any of the characters in chars (up to CHAR_SCAN_MAX_DELIM)
+size_t count_chars(const char* data, const size_t& L, const char* chars);
+
+inline unsigned int lowest_bit(const uint64_t& mask)
+{
+#if defined __GNUC__ || defined __clang__
+    return __builtin_ctzll(mask);
+#else
+    unsigned int i = 0;
+    while(!(mask & (uint64_t(1) << i))) ++i;
+    return i;
+#endif
+}
+
+inline unsigned int bit_count(const uint64_t& mask)
+{
+#if defined __GNUC__ || defined __clang__
+    return __builtin_popcountll(mask);
+#else
+    unsigned int output = 0;
+    for(uint64_t m = mask; m; m &= m - 1) ++output;
+    return output;
+#endif
+}
+
+}
+
+#endif // TOOLKIT_CHAR_SCAN
@@ -1,354 +1,641 @@
-#pragma once
-
-#ifndef DATASTREAM_HPP
-#define DATASTREAM_HPP
-
-#include <hyper/algorithm.hpp>
-#include <hyper/toolkit/clustered_vector.hpp>
-#include <hyper/toolkit/string.hpp>
-
-#ifdef AIDA_MODULE_GPU
-#include "AIDA/kernel.hpp"
-#endif
-
-#include <boost/filesystem.hpp>
-
-#define DATA_READOUT_REFRESH 1.0f/24
-#define STREAM_SCAN_BUFFER_SIZE 1000000
-#define STREAM_SEARCH_BUFFER_SIZE 300000
-#define STREAM_CACHE_SHORT_SEARCH_LIMIT 100
-
-#define ORIENTATION_NONE                0_BIT
-#define ORIENTATION_ROW                 1_BIT
-#define ORIENTATION_COLUMN              2_BIT
-#define ORIENTATION_UNKNOWN             3_BIT
-
-namespace hyperC
-{
-
-/**  =============================================================
-
-// Typedefs
-
-============================================================== **/
-
-typedef std::vector<unsigned int>                   dimArray;
-typedef std::vector<std::vector<unsigned int>>      dimMatrix;
-typedef std::vector<unsigned int>                   uint_v;
-typedef std::vector<std::vector<unsigned int>>      uint_m;
-
-typedef std::vector<std::string>                    tagList;
-typedef hyperC::VectorPair<std::string>                pairedTags;
-typedef std::vector<hyperC::Vector2<unsigned int>>     pairedCoords;
-typedef hyperC::Vector2<float>                         Vector2f;
-typedef hyperC::Vector2<unsigned int>                  Vector2u;
-
-/**  =============================================================
-
-// Stream classes
-
-============================================================== **/
-
-class _2Dstream;
-
-class _1Dstream{
-protected:
-
-    FILE* stream;
-    std::string streamFile;
-    unsigned int entrySize, byteSize;
-    std::vector<uint16_t> dataSizes;
-    std::vector<uint32_t> dataIndex;
-    std::vector<std::reference_wrapper<const std::string>> dataRefs;
-
-    char* readBuffer;
-    bool bIsReference; // If stream was extracted from another stream, access by data references
-
-    void update();
-    void getEntrySize();
-
-public:
-
-    inline const unsigned int& size() const{ return entrySize; }
-    inline char *const readbuf() const { return readBuffer; }
-
-    inline bool empty() const{ return entrySize == 0; }
-
-    inline void reset(){
-        fclose(stream);
-        dataIndex.erase(dataIndex.begin(), dataIndex.end());
-        dataSizes.erase(dataSizes.begin(), dataSizes.end());
-    }
-
-    void get(const unsigned int& i) const;
-    std::string getString(const unsigned int& i) const;
-    float getFloat(const unsigned int& i) const;
-
-    void import(std::vector<std::string>& storage) const;
-
-    bool check(const std::string& target) const;
-    bool find(uint_v& output, const std::string& target) const;
-    unsigned int getIndex(const std::string& query) const;
-
-    std::string operator[](const unsigned int& i) const;
-    float operator()(const unsigned int& i) const;
-    _1Dstream operator[](const std::vector<unsigned int>& index);
-    _1Dstream substream(const std::vector<unsigned int>& index);
-    _1Dstream& reduce(const std::vector<unsigned int>& index);
-
-    void openStream(const std::string& streamFile);
-
-    friend std::ostream& operator<<(std::ostream& output, _1Dstream other){
-        for(size_t i = 0; i < other.entrySize; ++i){
-            output << other.getString(i);
-            if(i < other.entrySize - 1) output << '\t';
-        }
-        return output;
-    }
-
-    _1Dstream& operator=(const _1Dstream& other);
-
-    _1Dstream(const _1Dstream& other);
-    _1Dstream(const std::string& filename, const std::vector<uint32_t>& dataIndex, const std::vector<uint16_t>& dataSizes);
-    _1Dstream(const _2Dstream& dataset, const unsigned int& index, const bool& row);
-    _1Dstream(const _1Dstream& other, const std::vector<unsigned int>& index);
-
-
-    ~_1Dstream(){
-        if(readBuffer != nullptr) delete[] readBuffer;
-        if(stream != nullptr) fclose(stream); }
-
-};
-
-struct coord_string : public std::string
-{
-    coord_string(const std::string str,
-                 const Vector2u coords):
-        std::string(str),
-        coords(coords){ }
-
-    coord_string(const std::string& str,
-                 const unsigned int& x,
-                 const unsigned int& y):
-        std::string(str),
-        coords(x, y){ }
-
-    inline friend std::ostream& operator<<(std::ostream& output, const coord_string& input)
-    {
-        return output << input.c_str() << '[' << input.coords.x << ',' << input.coords.y << ']';
-    }
-
-    hyperC::Vector2u coords;
-};
-
-class _2Dstream{
-protected:
-
-    FILE*                       stream;
-
-    std::string                 streamFile;
-
-    unsigned long long          streamSize;
-
-    unsigned int                numRows;
-    unsigned int                numColumns;
-
-    char*                       readBuffer;     // Search buffer - pre-allocate for rapid search
-
-    std::string                 delim;          // Delimiting characters (may be more than one)
-
-    uint8_t                     cached_alignment;
-
-    dimArray                    rowSizes;
-    dimArray                    rowDataSizes;
-
-    hyperC::vMatrix<uint16_t>      indexSizes;
-    hyperC::vMatrix<uint32_t>      indexPos;
-
-    bool verbose;
-    bool active;                                // Prevent conflicts between separate processes using this stream
-    bool imported;                              // Switch access modes if dataset has been loaded into RAM
-    bool bOpen;                                 // Has a connection been established?
-
-    std::vector<coord_string> coord_index;
-    hyperC::tree_vector<char, coord_string> *       search_index;
-
-public:
-
-    void reset();
-    inline void close(){ reset(); }
-    inline const bool& isOpen() const noexcept{ return bOpen; }
-
-    void reload();
-    void index(const int& max_levels = 1000);   // Create a search index to speed up repeated find operations
-
-    void update();
-
-    inline bool empty() const{ return rowSizes.empty(); }
-
-    std::vector<std::vector<std::string>> importData; // Import matrix - copy data to RAM for rapid-access tasks, and for writing
-
-    inline char *const readbuf() const{ return readBuffer; }
-
-    inline const bool& isActive() const{ return active; }
-    inline const bool& isImported() const{ return imported; }
-
-    inline const unsigned int& rowSize(const unsigned int& row) const{ return rowSizes[row]; }
-    inline const unsigned int& rowDataSize(const unsigned int& row) const{ return rowDataSizes[row]; }
-    unsigned int maxRowSize() const noexcept;
-
-    size_t getCharCount(const std::string& chars) const;
-
-    unsigned int colSize(const unsigned int& col) const;
-
-    inline const std::vector<uint16_t>& getRowIndexSizes(const unsigned int& row) const{ return indexSizes[row]; }
-    inline const std::vector<uint32_t>& getRowIndexPos(const unsigned int& row) const{ return indexPos[row]; }
-
-    inline const uint16_t& size_of(const unsigned int& x, const unsigned int& y) const{ return indexSizes[y][x]; }
-    inline const uint32_t& position(const unsigned int& x, const unsigned int& y) const{ return indexPos[y][x]; }
-
-    inline const unsigned int& nrow() const{ return numRows; }
-    inline const unsigned int& ncol() const{ return numColumns; }
-
-    inline void setVerbose(bool verboseStatus){ verbose = verboseStatus; }
-
-    const unsigned long long size() const{ return streamSize; }
-
-    _1Dstream getRow(const unsigned int& row) const;
-    _1Dstream getCol(const unsigned int& col) const;
-
-    /** @brief Get the index of a column by string matching. */
-    size_t column_index(const std::string& header) const;
-
-    /** @brief Get the index of a row by string matching. */
-    size_t row_index(const std::string& row_name) const;
-
-    void importRow(std::vector<std::string>& storage, const unsigned int& row) const;
-    void importCol(std::vector<std::string>& storage, const unsigned int& col) const;
-    void import();  // Load stream data into RAM and perform further operations on it
-    void release(); // Deallocate imported data and return to pure stream status
-
-    _1Dstream operator[](const unsigned int& y) const;
-    _1Dstream operator[](const std::string& x) const;
-
-    _2Dstream operator[](const std::vector<unsigned int>& rows) const;
-    _2Dstream operator[](const hyperC::VectorPair<unsigned int>& bounds) const;
-
-    bool find(hyperC::VectorPairU& output, const std::string& target, const float& size_threshold = 0.1f,
-              const float& match_threshold = 1.0f);
-    Vector2u getCoords(const std::string& target, const float& threshold = 0.1f);
-    unsigned int findRow(const std::string& target, const float& size_threshold = 0.1f);
-    unsigned int findCol(const std::string& target, const float& size_threshold = 0.1f);
-
-    bool check(const std::string& target,
-               const float& threshold = 0.1f,
-               const float& match_threshold = 1.0f) const;
-    std::string findMatch(const std::string& target, const float& threshold = 0.1f);
-    unsigned int getCount(const std::string& query, bool exact = true, const float& threshold = 0.1f);
-
-    void get(const unsigned int& x, const unsigned int& y) const; // Returns copied data - must delete pointer after every call
-    std::string getString(const unsigned int& x,
-                          const unsigned int& y) const;
-    template<typename T> std::string getString(const hyperC::Vector2<T>& coords) const{
-        return getString((unsigned int)coords.x, (unsigned int)coords.y);
-    }
-    float getFloat(const unsigned int& x, const unsigned int& y) const;
-
-    bool openStream(const boost::filesystem::path& filePath, const bool& update = true,
-                    const std::string& delim = ""){
-            return openStream(filePath.string(), update); }
-    bool openStream(const std::string& filename, const bool& update = true,
-                    const std::string& delim = "");
-    inline const std::string& getSourceFile() const{ return streamFile; }
-
-    friend std::ostream& operator<<(std::ostream& output, const _2Dstream& other){
-        for(size_t i = 0; i < other.nrow(); ++i){
-            for(size_t j = 0; j < other.ncol(); ++j){
-                if(j >= other.rowSizes[i]) break;
-                output << other.getString(j, i);
-                if((other.rowSizes[i] > 1) && (j < other.rowSizes[i] - 1)) output << '\t';
-            }
-            output << '\n';
-        }
-        return output;
-    }
-
-    _2Dstream(const _2Dstream& other); // Copy constructor - duplicates info but opens entirely new stream
-    _2Dstream& operator=(const _2Dstream& other);
-
-    explicit _2Dstream();
-    explicit _2Dstream(const std::string& filename, const bool& verbose = true,
-                       const std::string& delim = "");
-    explicit _2Dstream(std::string filename, hyperC::vMatrix<uint32_t>& indexPos,
-                       hyperC::vMatrix<uint16_t>& indexSizes,
-                    dimArray& rowSizes, dimArray& rowDataSizes,
-                    const std::string& delim);
-
-    ~_2Dstream(){
-        if(readBuffer) delete[] readBuffer;
-        if(stream) fclose(stream);
-        if(search_index) delete(search_index);
-    }
-};
-
-inline size_t nrow(const _2Dstream& stream){
-    return stream.nrow();
-}
-
-inline size_t ncol(const _2Dstream& stream){
-    return stream.ncol();
-}
-
-inline size_t rowSize(const _2Dstream& stream, const unsigned int& index){
-    return stream.rowSize(index);
-}
-
-typedef _2Dstream matrixStream;
-typedef _2Dstream m_stream;
-typedef _1Dstream vectorStream;
-typedef _1Dstream v_stream;
-
-// Datastream functions
-
-inline unsigned int numDelim(char* c, const unsigned int L){
-    unsigned int delimCount = 0;
-    char* newC = c;
-    for(size_t i = 0; i < L; ++i, ++newC){
-        if((*newC == '\t') || (*newC == '\n')) ++delimCount;
-    }
-    return delimCount;
-}
-
-bool isNumeric(const _1Dstream& stream, const unsigned int index);
-
-std::string getMatchingString(const std::string& query, _2Dstream& stream);
-Vector2u getBestStreamMatch(hyperC::VectorPairU& coords,
-                            _2Dstream& stream,
-                            const std::string& target,
-                            const unsigned char& params = CMP_STR_DEFAULT | CMP_STR_SW,
-                            const float& threshold = 0.5f);
-void getBestStreamMatchCoords(hyperC::VectorPairU& coords, _2Dstream& stream, const std::string& target);
-
-bool filterStreamMatch(std::vector<std::string>& prompt, _2Dstream& stream, bool getMatches = true);
-bool checkAnyStreamMatch(std::vector<std::string>& query, _2Dstream& stream, bool getMatches = false);
-
-// Get orientation of search results relative to data center
-uint8_t getSearchOrientation(const std::string& query, _2Dstream& dataSource);
-
-// Assess alignment of coordinates given back by a stream search query
-uint8_t assessCoordAlignment(const hyperC::VectorPairU& coords, _2Dstream& dataSource); // Relative to global boundaries
-uint8_t assessCoordAlignment(const hyperC::VectorPairU& inCoords, const hyperC::VectorPairU& outCoords); // Relative to other coordinates
-uint8_t assessCoordAlignment(const hyperC::VectorPairU& coords); // Relative to self
-
-// Data visualization
-
-//class _2DStreamDataViewer: public CVViewPanel{
-//protected:
-//public:
-//
-//    _2DStreamDataViewer()
-//};
-
-}
-
-#endif // DATASTREAM_HPP
+#pragma once
+
+#ifndef DATASTREAM_HPP
+#define DATASTREAM_HPP
+
+#include <hyper/algorithm.hpp>
+#include <hyper/toolkit/clustered_vector.hpp>
+#include <hyper/toolkit/string.hpp>
+#include <hyper/toolkit/char_scan.hpp>
+#include <hyper/toolkit/numeric_parse.hpp>
+
+#ifdef AIDA_MODULE_GPU
+#include "AIDA/kernel.hpp"
+#endif
+
+#include <boost/filesystem.hpp>
+
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <cstring>
+#include <cstdint>
+
+#define DATA_READOUT_REFRESH 1.0f/24
+#define STREAM_SCAN_BUFFER_SIZE 1000000
+#define STREAM_SEARCH_BUFFER_SIZE 300000
+#define STREAM_CACHE_SHORT_SEARCH_LIMIT 100
+#define STREAM_PARALLEL_INDEX_MIN_SIZE 16000000   // Index smaller files on a single thread
+#define STREAM_PARALLEL_SEARCH_MIN_SIZE 4000000   // Search smaller files on a single thread
+#define STREAM_INDEX_SIDECAR_MIN_SIZE 16000000    // Cache the index of larger files next to the source
+#define STREAM_INDEX_SIDECAR_EXT ".hidx"
+#define STREAM_INDEX_CHECKSUM_SIZE 65536
+#define STREAM_INDEX_VERSION 2
+#define STREAM_COLUMN_EXT ".hcol"                 // Spilled column cache: source path + ".c<column>" + extension
+#define STREAM_COLUMN_VERSION 1
+#define STREAM_FOLLOW_INTERVAL 0.5f               // Seconds between size checks in _2Dstream::follow()
+
+#define ORIENTATION_NONE                0_BIT
+#define ORIENTATION_ROW                 1_BIT
+#define ORIENTATION_COLUMN              2_BIT
+#define ORIENTATION_UNKNOWN             3_BIT
+
+namespace hyperC
+{
+
+/**  =============================================================
+
+// Typedefs
+
+============================================================== **/
+
+typedef std::vector<unsigned int>                   dimArray;
+typedef std::vector<std::vector<unsigned int>>      dimMatrix;
+typedef std::vector<unsigned int>                   uint_v;
+typedef std::vector<std::vector<unsigned int>>      uint_m;
+
+typedef std::vector<std::string>                    tagList;
+typedef hyperC::VectorPair<std::string>                pairedTags;
+typedef std::vector<hyperC::Vector2<unsigned int>>     pairedCoords;
+typedef hyperC::Vector2<float>                         Vector2f;
+typedef hyperC::Vector2<unsigned int>                  Vector2u;
+
+/**  =============================================================
+
+// Stream classes
+
+============================================================== **/
+
+class _2Dstream;
+
+// Receives each newly completed row of a followed stream; return false to stop following
+typedef std::function<bool(const _2Dstream&, const unsigned int&)> stream_row_callback;
+
+/** @brief Read-only memory map of a stream source file.
+    Shared between a _2Dstream and the _1Dstreams extracted from it so that
+    cells can be read straight from the mapped pages with no per-cell I/O. */
+
+class stream_map{
+protected:
+
+    const char* mapData;
+    size_t      mapSize;
+
+public:
+
+    inline const char* data() const noexcept{ return mapData; }
+    inline const size_t& size() const noexcept{ return mapSize; }
+    inline bool valid() const noexcept{ return mapData != nullptr; }
+
+    inline const char* at(const unsigned long long& pos) const{ return mapData + pos; }
+
+    stream_map(const std::string& filename);
+    stream_map(const stream_map& other) = delete;
+    stream_map& operator=(const stream_map& other) = delete;
+
+    ~stream_map();
+};
+
+/** @brief Compact cell index.  Rows are laid out CSR-style: one 64-bit offset and
+    one pointer per row into a single packed array of (offset from row start, size)
+    pairs, stored at the narrowest width (1, 2, 4 or 8 bytes) that fits the row. */
+
+class stream_index{
+protected:
+
+    std::vector<uint64_t>   rowOffsets;     // Absolute position of each row
+    std::vector<uint64_t>   rowPointers;    // Start of each row within cellData
+    std::vector<uint8_t>    rowWidths;      // Bytes per packed field in each row
+    std::vector<uint8_t>    cellData;       // Packed cell offsets and sizes
+
+    inline uint64_t field(const size_t& y, const size_t& i) const{
+        const uint8_t* c = cellData.data() + rowPointers[y] + i*rowWidths[y];
+        switch(rowWidths[y]){
+            case 1: return *c;
+            case 2: { uint16_t v; memcpy(&v, c, 2); return v; }
+            case 4: { uint32_t v; memcpy(&v, c, 4); return v; }
+            default: { uint64_t v; memcpy(&v, c, 8); return v; }
+        }
+    }
+
+public:
+
+    inline size_t size() const noexcept{ return rowOffsets.size(); }
+    inline bool empty() const noexcept{ return rowOffsets.empty(); }
+
+    inline const uint64_t& row_offset(const size_t& y) const{ return rowOffsets[y]; }
+    inline uint64_t position(const size_t& x, const size_t& y) const{ return rowOffsets[y] + field(y, 2*x); }
+    inline uint64_t size_of(const size_t& x, const size_t& y) const{ return field(y, 2*x + 1); }
+
+    // Bytes held by the index
+    inline size_t memory() const noexcept{
+        return rowOffsets.size()*(2*sizeof(uint64_t) + sizeof(uint8_t)) + cellData.size();
+    }
+
+    void push_row(const uint64_t* positions, const uint64_t* sizes, const size_t& count);
+    void push_row(const stream_index& other, const size_t& y, const size_t& count);
+    void append(const stream_index& other);
+    void reserve(const size_t& rows, const size_t& bytes);
+    void truncate(const size_t& rows);  // Drop every row from rows onward
+    void clear();
+
+    friend class _2Dstream;
+};
+
+/** @brief Exact-match cell index.  An open-addressing table maps the hash of each
+    case-folded cell to the packed coordinates ((y << 32) | x) of every cell sharing
+    that hash, so hits must be verified against the cell text. */
+
+class stream_hash_index{
+protected:
+
+    struct slot
+    {
+        uint64_t hash;      // 0 - empty
+        uint64_t begin;     // First entry in coords
+        uint64_t count;
+    };
+
+    std::vector<slot>       slots;      // Power-of-two capacity, linear probing
+    std::vector<uint64_t>   coords;     // Coordinates grouped by hash, in file order
+
+public:
+
+    static uint64_t hash(const std::string_view& s);
+
+    // Build from (hash, packed coordinates) pairs; the input is sorted in place
+    void build(std::vector<std::pair<uint64_t, uint64_t>>& entries);
+
+    // Candidate coordinates for a hash, or nullptr if there are none
+    const uint64_t* lookup(const uint64_t& hash, size_t& count) const;
+
+    inline size_t size() const noexcept{ return coords.size(); }
+    inline bool empty() const noexcept{ return coords.empty(); }
+    inline size_t memory() const noexcept{ return slots.size()*sizeof(slot) + coords.size()*sizeof(uint64_t); }
+};
+
+/** @brief Trigram inverted index over case-folded cell text.  Selects the candidate
+    cells of substring and fuzzy queries, which are then scored against the cell text.
+    Cells are numbered in row-major order. */
+
+class stream_ngram_index{
+protected:
+
+    std::vector<uint32_t>   keys;       // Sorted distinct trigrams
+    std::vector<uint64_t>   starts;     // Start of each posting list in postings (keys.size() + 1)
+    std::vector<uint32_t>   postings;   // Cell numbers, ascending within each list
+    std::vector<uint64_t>   rowStarts;  // Number of the first cell of each row
+
+public:
+
+    // Distinct trigrams of s, sorted
+    static void grams(const std::string_view& s, std::vector<uint32_t>& output);
+
+    // Build from (trigram << 32 | cell) entries; the input is sorted in place
+    void build(std::vector<uint64_t>& entries, const std::vector<uint64_t>& rowStarts);
+
+    // Cells sharing at least minShared of the given distinct trigrams, in ascending order
+    void candidates(const std::vector<uint32_t>& grams, const size_t& minShared,
+                    std::vector<uint32_t>& output) const;
+
+    Vector2u coords(const uint32_t& cell) const;
+
+    inline size_t size() const noexcept{ return postings.size(); }
+    inline size_t memory() const noexcept{
+        return keys.size()*sizeof(uint32_t) + starts.size()*sizeof(uint64_t) +
+               postings.size()*sizeof(uint32_t) + rowStarts.size()*sizeof(uint64_t);
+    }
+};
+
+/** @brief Numeric column parsed once from a stream.  Values are contiguous
+    (NAN where a cell is not a number), with a bitmap flagging the valid cells. */
+
+class stream_column{
+protected:
+
+    std::vector<double>     values;
+    std::vector<uint64_t>   validity;
+    size_t                  numValid;
+
+public:
+
+    inline size_t size() const noexcept{ return values.size(); }
+    inline const size_t& validSize() const noexcept{ return numValid; }
+    inline const double* data() const noexcept{ return values.data(); }
+
+    inline bool valid(const size_t& i) const{ return validity[i >> 6] & (uint64_t(1) << (i & 63)); }
+    inline const double& operator[](const size_t& i) const{ return values[i]; }
+
+    void set(const size_t& i, const double& value);
+    void getValues(std::vector<float>& output) const;
+    void getValidValues(std::vector<float>& output) const;
+
+    bool save(const std::string& path, const uint64_t& sourceSize, const int64_t& sourceTime) const;
+    bool load(const std::string& path, const uint64_t& sourceSize, const int64_t& sourceTime);
+
+    stream_column(const size_t& L = 0):
+        values(L, NAN),
+        validity((L + 63)/64, 0),
+        numValid(0){ }
+};
+
+class _1Dstream{
+protected:
+
+    FILE* stream;
+    std::string streamFile;
+    std::shared_ptr<stream_map> mapping;   // Read from mapped pages if the source stream was mapped
+    unsigned int entrySize, byteSize;
+    std::vector<uint32_t> dataSizes;
+    std::vector<uint64_t> dataIndex;
+    std::vector<std::reference_wrapper<const std::string>> dataRefs;
+    std::shared_ptr<const stream_column> column;   // Parsed values, if the source column was cached
+
+    char* readBuffer;
+    bool bIsReference; // If stream was extracted from another stream, access by data references
+
+    void update();
+    void getEntrySize();
+
+public:
+
+    inline const unsigned int& size() const{ return entrySize; }
+    inline char *const readbuf() const { return readBuffer; }
+    inline bool isMapped() const{ return mapping != nullptr; }
+    inline const std::shared_ptr<const stream_column>& getColumn() const noexcept{ return column; }
+
+    inline bool empty() const{ return entrySize == 0; }
+
+    inline void reset(){
+        fclose(stream);
+        column.reset();
+        dataIndex.erase(dataIndex.begin(), dataIndex.end());
+        dataSizes.erase(dataSizes.begin(), dataSizes.end());
+    }
+
+    const char* get(const unsigned int& i) const; // Thread-local copy, valid until the next get() on the calling thread
+    std::string getString(const unsigned int& i) const;
+    float getFloat(const unsigned int& i) const;
+
+    // Untrimmed views of every entry, appended to output (see _2Dstream::view for lifetime)
+    void view(std::vector<std::string_view>& output) const;
+
+    void import(std::vector<std::string>& storage) const;
+
+    bool check(const std::string& target) const;
+    bool find(uint_v& output, const std::string& target) const;
+    unsigned int getIndex(const std::string& query) const;
+
+    std::string operator[](const unsigned int& i) const;
+    float operator()(const unsigned int& i) const;
+    _1Dstream operator[](const std::vector<unsigned int>& index);
+    _1Dstream substream(const std::vector<unsigned int>& index);
+    _1Dstream& reduce(const std::vector<unsigned int>& index);
+
+    void openStream(const std::string& streamFile);
+
+    friend std::ostream& operator<<(std::ostream& output, _1Dstream other){
+        for(size_t i = 0; i < other.entrySize; ++i){
+            output << other.getString(i);
+            if(i < other.entrySize - 1) output << '\t';
+        }
+        return output;
+    }
+
+    _1Dstream& operator=(const _1Dstream& other);
+
+    _1Dstream(const _1Dstream& other);
+    _1Dstream(const std::string& filename, const std::vector<uint64_t>& dataIndex, const std::vector<uint32_t>& dataSizes);
+    _1Dstream(const _2Dstream& dataset, const unsigned int& index, const bool& row);
+    _1Dstream(const _1Dstream& other, const std::vector<unsigned int>& index);
+
+
+    ~_1Dstream(){
+        if(readBuffer != nullptr) delete[] readBuffer;
+        if(stream != nullptr) fclose(stream); }
+
+};
+
+struct coord_string : public std::string
+{
+    coord_string(const std::string str,
+                 const Vector2u coords):
+        std::string(str),
+        coords(coords){ }
+
+    coord_string(const std::string& str,
+                 const unsigned int& x,
+                 const unsigned int& y):
+        std::string(str),
+        coords(x, y){ }
+
+    inline friend std::ostream& operator<<(std::ostream& output, const coord_string& input)
+    {
+        return output << input.c_str() << '[' << input.coords.x << ',' << input.coords.y << ']';
+    }
+
+    hyperC::Vector2u coords;
+};
+
+/** @brief Delimited text stream indexed by cell.  The const accessors (get, getString,
+    getFloat, check, locate) read through the memory map or positional reads into
+    thread-local buffers, so one opened stream may serve any number of reader
+    threads.  Methods that modify the stream require exclusive access. */
+
+class _2Dstream{
+protected:
+
+    FILE*                       stream;
+
+    std::string                 streamFile;
+
+    unsigned long long          streamSize;
+
+    unsigned int                numRows;
+    unsigned int                numColumns;
+
+    char*                       readBuffer;     // Search buffer - pre-allocate for rapid search
+
+    std::shared_ptr<stream_map> mapping;        // Memory map of the source file (mapped access mode only)
+
+    std::string                 delim;          // Delimiting characters (may be more than one)
+
+    uint8_t                     cached_alignment;
+
+    dimArray                    rowSizes;
+    dimArray                    rowDataSizes;
+
+    stream_index                cellIndex;      // Position and size of every cell
+
+    bool verbose;
+    bool active;                                // Prevent conflicts between separate processes using this stream
+    bool imported;                              // Switch access modes if dataset has been loaded into RAM
+    bool bOpen;                                 // Has a connection been established?
+    bool bMapped;                               // Read cells from a memory map instead of fseek/fread
+    bool bSidecar;                              // Load and save the cell index as a sidecar file
+
+    unsigned int numThreads;                    // Worker threads for indexing and search (0 - use all hardware threads)
+
+    std::shared_ptr<const stream_hash_index>    search_index;   // Exact-match index (see index())
+    std::shared_ptr<const stream_ngram_index>   ngram_index;    // Substring and fuzzy candidate index (see indexNgrams())
+
+    mutable std::vector<std::shared_ptr<const stream_column>> columnCache;  // Parsed numeric columns (atomic access)
+    mutable std::mutex                                        cacheMutex;   // Serializes column builds
+
+    std::string column_path(const unsigned int& col) const;
+
+    // Exact case-insensitive cell matches from the search index, appended to output if provided
+    bool lookup_index(const std::string& target, hyperC::VectorPairU* output) const;
+
+    // Candidate cells for a query from the n-gram index; false if the index cannot narrow the search
+    bool lookup_ngrams(const std::string& target, const size_t& maxMissing, std::vector<uint32_t>& output) const;
+
+    // Offsets of case-insensitive matches of target in cells no larger than maxCellSize, in file order
+    void search_exact(std::vector<unsigned long long>& output, const std::string& target,
+                      const unsigned long long& maxCellSize, const bool& bFirst) const;
+
+    void reset_index();
+
+    // Rows terminated by a line break (all but an unterminated final row)
+    size_t complete_rows() const;
+
+public:
+
+    void reset();
+    inline void close(){ reset(); }
+    inline const bool& isOpen() const noexcept{ return bOpen; }
+
+    /** @brief Switch to memory-mapped access.  Cell reads, searches and index
+        updates are served from the mapped pages instead of the FILE stream. */
+    bool map();
+    void unmap();
+    inline bool isMapped() const noexcept{ return mapping != nullptr; }
+    inline const std::shared_ptr<stream_map>& getMapping() const noexcept{ return mapping; }
+
+    void reload();
+    void index(const int& max_levels = 1000);   // Create a hash index of cell text for O(1) exact find, check and getCount (max_levels is unused)
+    inline bool isIndexed() const noexcept{ return search_index != nullptr; }
+
+    /** @brief Build a trigram index of cell text.  find() then scores only the cells that
+        share enough trigrams with the query, for substring (match_threshold == 1) and
+        fuzzy queries alike.  The fuzzy prefilter is a heuristic: a cell sharing fewer
+        trigrams than a query with (1 - match_threshold) of its characters missing
+        would keep is not scored. */
+    void indexNgrams();
+    inline bool isNgramIndexed() const noexcept{ return ngram_index != nullptr; }
+
+    void update();
+
+    /** @brief Index only the bytes appended to the source since the last update.  Rows
+        from the end of the last complete row onward are re-indexed and the row tables
+        extended in place, so the cost is proportional to the new data.  A source that
+        shrank is indexed again from scratch.  The search indexes and column caches are
+        released, as they no longer cover every row.  Not safe to call while other
+        threads read the stream.  Returns the number of newly completed rows, which are
+        the last rows before any unterminated final row. */
+    size_t refresh();
+
+    // Refresh once and pass each newly completed row to callback.  Returns the rows delivered.
+    size_t poll(const stream_row_callback& callback);
+
+    /** @brief Tail the source: poll every interval seconds until callback returns false
+        or stop is set.  Rows already complete when following begins are not delivered. */
+    void follow(const stream_row_callback& callback, const float& interval = STREAM_FOLLOW_INTERVAL,
+                const std::atomic<bool>* stop = nullptr);
+
+    /** @brief Save or restore the cell index as a binary sidecar file (default: source path + ".hidx").
+        A sidecar is only restored if the source size, modification time and checksum still match. */
+    bool saveIndex(const std::string& path = "") const;
+    bool loadIndex(const std::string& path = "", const std::string& delim = "");
+    inline void setSidecar(const bool& status){ bSidecar = status; }
+
+    /** @brief Parse a column once into a typed cache used by getFloat(), by the
+        _1Dstreams taken from the column and by the stream statistics.  A column
+        spilled to disk (source path + ".c<column>.hcol") is reloaded instead of
+        being parsed again, provided the source is unchanged. */
+    std::shared_ptr<const stream_column> cacheColumn(const unsigned int& col) const;
+    std::shared_ptr<const stream_column> getColumnCache(const unsigned int& col) const;
+    bool spillColumn(const unsigned int& col, const bool& release = true);
+    void releaseColumn(const unsigned int& col);
+    void clearColumnCache();
+
+    inline bool empty() const{ return rowSizes.empty(); }
+
+    std::vector<std::vector<std::string>> importData; // Import matrix - copy data to RAM for rapid-access tasks, and for writing
+
+    inline char *const readbuf() const{ return readBuffer; }
+
+    inline const bool& isActive() const{ return active; }
+    inline const bool& isImported() const{ return imported; }
+
+    inline const unsigned int& rowSize(const unsigned int& row) const{ return rowSizes[row]; }
+    inline const unsigned int& rowDataSize(const unsigned int& row) const{ return rowDataSizes[row]; }
+    unsigned int maxRowSize() const noexcept;
+
+    size_t getCharCount(const std::string& chars) const;
+
+    unsigned int colSize(const unsigned int& col) const;
+
+    std::vector<uint32_t> getRowIndexSizes(const unsigned int& row) const;
+    std::vector<uint64_t> getRowIndexPos(const unsigned int& row) const;
+    inline const stream_index& getIndex() const noexcept{ return cellIndex; }
+
+    inline uint64_t size_of(const unsigned int& x, const unsigned int& y) const{ return cellIndex.size_of(x, y); }
+    inline uint64_t position(const unsigned int& x, const unsigned int& y) const{ return cellIndex.position(x, y); }
+
+    inline const unsigned int& nrow() const{ return numRows; }
+    inline const unsigned int& ncol() const{ return numColumns; }
+
+    inline void setVerbose(bool verboseStatus){ verbose = verboseStatus; }
+    inline void setThreads(const unsigned int& threads){ numThreads = threads; }
+
+    const unsigned long long size() const{ return streamSize; }
+
+    _1Dstream getRow(const unsigned int& row) const;
+    _1Dstream getCol(const unsigned int& col) const;
+
+    /** @brief Get the index of a column by string matching. */
+    size_t column_index(const std::string& header) const;
+
+    /** @brief Get the index of a row by string matching. */
+    size_t row_index(const std::string& row_name) const;
+
+    void importRow(std::vector<std::string>& storage, const unsigned int& row) const;
+    void importCol(std::vector<std::string>& storage, const unsigned int& col) const;
+    void import();  // Load stream data into RAM and perform further operations on it
+    void release(); // Deallocate imported data and return to pure stream status
+
+    _1Dstream operator[](const unsigned int& y) const;
+    _1Dstream operator[](const std::string& x) const;
+
+    _2Dstream operator[](const std::vector<unsigned int>& rows) const;
+    _2Dstream operator[](const hyperC::VectorPair<unsigned int>& bounds) const;
+
+    bool find(hyperC::VectorPairU& output, const std::string& target, const float& size_threshold = 0.1f,
+              const float& match_threshold = 1.0f);
+    Vector2u getCoords(const std::string& target, const float& threshold = 0.1f);
+    unsigned int findRow(const std::string& target, const float& size_threshold = 0.1f);
+    unsigned int findCol(const std::string& target, const float& size_threshold = 0.1f);
+
+    bool check(const std::string& target,
+               const float& threshold = 0.1f,
+               const float& match_threshold = 1.0f) const;
+    std::string findMatch(const std::string& target, const float& threshold = 0.1f);
+    unsigned int getCount(const std::string& query, bool exact = true, const float& threshold = 0.1f);
+
+    Vector2u locate(const unsigned long long& offset) const; // Coordinates of the cell containing a byte offset
+
+    const char* get(const unsigned int& x, const unsigned int& y) const; // Thread-local copy, valid until the next get() on the calling thread
+    std::string getString(const unsigned int& x,
+                          const unsigned int& y) const;
+    template<typename T> std::string getString(const hyperC::Vector2<T>& coords) const{
+        return getString((unsigned int)coords.x, (unsigned int)coords.y);
+    }
+
+    /** Zero-copy cell views, trimmed as by getString().  Views point into the memory
+        map or imported data; on a buffered stream they point into a thread-local
+        buffer that is valid until the next view call on the same thread. */
+
+    std::string_view view(const unsigned int& x, const unsigned int& y) const;
+    template<typename T> std::string_view view(const hyperC::Vector2<T>& coords) const{
+        return view((unsigned int)coords.x, (unsigned int)coords.y);
+    }
+
+    void viewRow(std::vector<std::string_view>& output, const unsigned int& row) const;
+    void viewCol(std::vector<std::string_view>& output, const unsigned int& col) const; // Skips rows without the column
+    void viewRect(std::vector<std::string_view>& output, const Vector2u& begin,
+                  const Vector2u& end) const; // Row-major over [begin, end), missing cells are empty
+    float getFloat(const unsigned int& x, const unsigned int& y) const;
+
+    bool openStream(const boost::filesystem::path& filePath, const bool& update = true,
+                    const std::string& delim = "", const bool& mapped = false){
+            return openStream(filePath.string(), update, delim, mapped); }
+    bool openStream(const std::string& filename, const bool& update = true,
+                    const std::string& delim = "", const bool& mapped = false);
+    inline const std::string& getSourceFile() const{ return streamFile; }
+
+    friend std::ostream& operator<<(std::ostream& output, const _2Dstream& other){
+        for(size_t i = 0; i < other.nrow(); ++i){
+            for(size_t j = 0; j < other.ncol(); ++j){
+                if(j >= other.rowSizes[i]) break;
+                output << other.getString(j, i);
+                if((other.rowSizes[i] > 1) && (j < other.rowSizes[i] - 1)) output << '\t';
+            }
+            output << '\n';
+        }
+        return output;
+    }
+
+    _2Dstream(const _2Dstream& other); // Copy constructor - duplicates info but opens entirely new stream
+    _2Dstream& operator=(const _2Dstream& other);
+
+    explicit _2Dstream();
+    explicit _2Dstream(const std::string& filename, const bool& verbose = true,
+                       const std::string& delim = "", const bool& mapped = false);
+    explicit _2Dstream(const std::string& filename, const stream_index& cellIndex,
+                       const dimArray& rowSizes, const dimArray& rowDataSizes,
+                       const std::string& delim);
+
+    ~_2Dstream(){
+        if(readBuffer) delete[] readBuffer;
+        if(stream) fclose(stream);
+    }
+};
+
+inline size_t nrow(const _2Dstream& stream){
+    return stream.nrow();
+}
+
+inline size_t ncol(const _2Dstream& stream){
+    return stream.ncol();
+}
+
+inline size_t rowSize(const _2Dstream& stream, const unsigned int& index){
+    return stream.rowSize(index);
+}
+
+typedef _2Dstream matrixStream;
+typedef _2Dstream m_stream;
+typedef _1Dstream vectorStream;
+typedef _1Dstream v_stream;
+
+// Datastream functions
+
+inline unsigned int numDelim(char* c, const unsigned int L){
+    return count_chars(c, L, "\t\n");
+}
+
+bool isNumeric(const _1Dstream& stream, const unsigned int index);
+
+std::string getMatchingString(const std::string& query, _2Dstream& stream);
+Vector2u getBestStreamMatch(hyperC::VectorPairU& coords,
+                            _2Dstream& stream,
+                            const std::string& target,
+                            const unsigned char& params = CMP_STR_DEFAULT | CMP_STR_SW,
+                            const float& threshold = 0.5f);
+void getBestStreamMatchCoords(hyperC::VectorPairU& coords, _2Dstream& stream, const std::string& target);
+
+bool filterStreamMatch(std::vector<std::string>& prompt, _2Dstream& stream, bool getMatches = true);
+bool checkAnyStreamMatch(std::vector<std::string>& query, _2Dstream& stream, bool getMatches = false);
+
+// Get orientation of search results relative to data center
+uint8_t getSearchOrientation(const std::string& query, _2Dstream& dataSource);
+
+// Assess alignment of coordinates given back by a stream search query
+uint8_t assessCoordAlignment(const hyperC::VectorPairU& coords, _2Dstream& dataSource); // Relative to global boundaries
+uint8_t assessCoordAlignment(const hyperC::VectorPairU& inCoords, const hyperC::VectorPairU& outCoords); // Relative to other coordinates
+uint8_t assessCoordAlignment(const hyperC::VectorPairU& coords); // Relative to self
+
+// Data visualization
+
+//class _2DStreamDataViewer: public CVViewPanel{
+//protected:
+//public:
+//
+//    _2DStreamDataViewer()
+//};
+
+}
+
+#endif // DATASTREAM_HPP
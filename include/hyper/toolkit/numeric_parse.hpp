@@ -0,0 +1,55 @@
+/** ////////////////////////////////////////////////////////////////
+
+    *** Hyper C++ - A simplified C++ experience ***
+
+        Yet (another) open source library for C++
+
+        Original Copyright (C) Damian Tran 2019
+
+        By aiFive Technologies, Inc. for developers
+
+    Copying and redistribution of this code is freely permissible.
+    Inclusion of the above notice is preferred but not required.
+
+    This software is provided AS IS without any expressed or implied
+    warranties.  By using this code, and any modifications and
+    variants arising thereof, you are assuming all liabilities and
+    risks that may be thus associated.
+
+////////////////////////////////////////////////////////////////  **/
+
+#pragma once
+
+#ifndef TOOLKIT_NUMERIC_PARSE
+#define TOOLKIT_NUMERIC_PARSE
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+namespace hyperC
+{
+
+/** @brief Locale-independent number parsing for cells of delimited text.
+
+    The whole of [begin, end) must be a number, less any surrounding spaces or
+    quotes: [+-]digits[.digits][(e|E)[+-]digits].  Decimal values with up to 19
+    significant digits and a power of ten within 1e22 are converted exactly in
+    double precision, and the rare remainder falls back to the classic locale.
+    Returns false (leaving output untouched) if the text is not a number. */
+
+bool parse_double(const char* begin, const char* end, double& output);
+bool parse_float(const char* begin, const char* end, float& output);
+bool parse_int(const char* begin, const char* end, int64_t& output);
+
+inline bool parse_double(const std::string_view& s, double& output){ return parse_double(s.data(), s.data() + s.size(), output); }
+inline bool parse_float(const std::string_view& s, float& output){ return parse_float(s.data(), s.data() + s.size(), output); }
+inline bool parse_int(const std::string_view& s, int64_t& output){ return parse_int(s.data(), s.data() + s.size(), output); }
+
+// Parse L cells into output, writing NAN for cells that are not numbers.  Returns the number of valid cells.
+size_t parse_floats(const std::string_view* cells, const size_t& L, float* output);
+size_t parse_doubles(const std::string_view* cells, const size_t& L, double* output);
+
+}
+
+#endif // TOOLKIT_NUMERIC_PARSE
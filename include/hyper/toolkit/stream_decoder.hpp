@@ -0,0 +1,124 @@
+/** ////////////////////////////////////////////////////////////////
+
+    *** Hyper C++ - A simplified C++ experience ***
+
+        Yet (another) open source library for C++
+
+        Original Copyright (C) Damian Tran 2019
+
+        By aiFive Technologies, Inc. for developers
+
+    Copying and redistribution of this code is freely permissible.
+    Inclusion of the above notice is preferred but not required.
+
+    This software is provided AS IS without any expressed or implied
+    warranties.  By using this code, and any modifications and
+    variants arising thereof, you are assuming all liabilities and
+    risks that may be thus associated.
+
+////////////////////////////////////////////////////////////////  **/
+
+#pragma once
+
+#ifndef TOOLKIT_STREAM_DECODER
+#define TOOLKIT_STREAM_DECODER
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <cstdint>
+
+#define STREAM_DECODER_SPAN         1048576     // Decompressed bytes between access points, and per cached block
+#define STREAM_DECODER_WINDOW       32768       // Deflate history needed to resume inflating mid-stream
+#define STREAM_DECODER_INPUT_SIZE   262144      // Compressed bytes read at a time
+#define STREAM_DECODER_CHUNK_SIZE   1048576     // Decompressed bytes handed to a scan reader at a time
+#define STREAM_DECODER_EXT          ".hblk"     // Access point sidecar: source path + extension
+#define STREAM_DECODER_VERSION      1
+
+#define STREAM_CODEC_NONE           0
+#define STREAM_CODEC_GZIP           1
+#define STREAM_CODEC_ZSTD           2           // Requires building with HYPER_ZSTD (and linking libzstd)
+
+namespace hyperC
+{
+
+// Receives decompressed bytes [offset, offset + L); return false to stop reading
+typedef std::function<bool(const char*, const size_t&, const unsigned long long&)> stream_block_reader;
+
+/** @brief Random access to a compressed stream source.
+
+    One decompression pass records an access point about every STREAM_DECODER_SPAN
+    bytes of output: the compressed position and, for gzip, the 32 KB of history
+    needed to resume inflating there.  read() then decompresses only the block that
+    holds the requested bytes, keeping the last block per thread, and scan() streams
+    a range with decompression running ahead of the reader on a second thread.
+
+    Multi-member gzip files (e.g. from bgzip or pigz) are supported.  zstd can only
+    resume at frame boundaries, so random access to a zstd source is as fine as its
+    frames: files written as many frames (pzstd, the zstd seekable format) do well,
+    while a single-frame file is decompressed from its start for every block. */
+
+class stream_decoder
+{
+protected:
+
+    struct access_point
+    {
+        uint64_t                out;        // Decompressed position
+        uint64_t                in;         // Compressed position
+        uint8_t                 bits;       // Unconsumed bits of the byte before in (gzip)
+        std::vector<uint8_t>    window;     // Output preceding the point (gzip)
+    };
+
+    std::string                 filename;
+    uint8_t                     codec;
+    uint64_t                    sourceSize;     // Compressed bytes
+    uint64_t                    outputSize;     // Decompressed bytes
+    std::vector<access_point>   points;         // Ascending in both positions
+    uint64_t                    serial;         // Identifies this decoder in the per-thread block cache
+
+    bool build_gzip();
+    bool decode_gzip(const access_point& point, const uint64_t& begin, const uint64_t& end,
+                     const stream_block_reader& reader) const;
+
+#if defined HYPER_ZSTD
+    bool build_zstd();
+    bool decode_zstd(const access_point& point, const uint64_t& begin, const uint64_t& end,
+                     const stream_block_reader& reader) const;
+#endif
+
+    // Decompress [begin, end) from the last access point at or before begin, on the calling thread
+    bool decode(const uint64_t& begin, const uint64_t& end, const stream_block_reader& reader) const;
+
+public:
+
+    // Codec of a file from its magic number
+    static uint8_t detect(const std::string& filename);
+    inline static bool compressed(const std::string& filename){ return detect(filename) != STREAM_CODEC_NONE; }
+
+    /** @brief Open a compressed source.  Access points are restored from sidecar if it
+        still matches the source, and are otherwise built and saved to sidecar (if given). */
+    bool open(const std::string& filename, const std::string& sidecar = "");
+
+    // Copy L decompressed bytes from pos to output; returns the number copied.  Thread-safe.
+    size_t read(char* output, const unsigned long long& pos, const size_t& L) const;
+
+    // Feed [begin, end) to reader in order, decompressing ahead on a worker thread
+    void scan(const unsigned long long& begin, const unsigned long long& end,
+              const stream_block_reader& reader) const;
+
+    bool save(const std::string& path) const;
+    bool load(const std::string& path);
+
+    inline const uint64_t& size() const noexcept{ return outputSize; }
+    inline const uint64_t& compressedSize() const noexcept{ return sourceSize; }
+    inline const uint8_t& getCodec() const noexcept{ return codec; }
+    inline size_t numPoints() const noexcept{ return points.size(); }
+    inline bool valid() const noexcept{ return !points.empty(); }
+
+    stream_decoder();
+};
+
+}
+
+#endif // TOOLKIT_STREAM_DECODER
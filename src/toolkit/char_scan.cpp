@@ -0,0 +1,186 @@
+/** ////////////////////////////////////////////////////////////////
+
+    *** Hyper C++ - A simplified C++ experience ***
+
+        Yet (another) open source library for C++
+
+        Original Copyright (C) Damian Tran 2019
+
+        By aiFive Technologies, Inc. for developers
+
+    Copying and redistribution of this code is freely permissible.
+    Inclusion of the above notice is preferred but not required.
+
+    This software is provided AS IS without any expressed or implied
+    warranties.  By using this code, and any modifications and
+    variants arising thereof, you are assuming all liabilities and
+    risks that may be thus associated.
+
+////////////////////////////////////////////////////////////////  **/
+
+#include "hyper/toolkit/char_scan.hpp"
+
+#include <cstring>
+
+#if defined __AVX2__
+#include <immintrin.h>
+#define CHAR_SCAN_AVX2
+#elif defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CHAR_SCAN_SSE2
+#endif
+
+using namespace std;
+
+namespace hyperC
+{
+
+/*
+    One 64-byte block held in vector registers.  match() returns the
+    bit positions of a character within the block.
+*/
+
+struct scan_block
+{
+#if defined CHAR_SCAN_AVX2
+
+    __m256i lo, hi;
+
+    scan_block(const char* c):
+        lo(_mm256_loadu_si256((const __m256i*)c)),
+        hi(_mm256_loadu_si256((const __m256i*)(c + 32))) { }
+
+    inline uint64_t match(const char& c) const
+    {
+        const __m256i v = _mm256_set1_epi8(c);
+        return uint64_t(uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, v)))) |
+               (uint64_t(uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, v)))) << 32);
+    }
+
+#elif defined CHAR_SCAN_SSE2
+
+    __m128i v[4];
+
+    scan_block(const char* c)
+    {
+        for(size_t i = 0; i < 4; ++i)
+        {
+            v[i] = _mm_loadu_si128((const __m128i*)(c + 16*i));
+        }
+    }
+
+    inline uint64_t match(const char& c) const
+    {
+        const __m128i s = _mm_set1_epi8(c);
+        uint64_t output = 0;
+        for(size_t i = 0; i < 4; ++i)
+        {
+            output |= uint64_t(uint16_t(_mm_movemask_epi8(_mm_cmpeq_epi8(v[i], s)))) << (16*i);
+        }
+        return output;
+    }
+
+#else
+
+    const char* data;
+
+    scan_block(const char* c):
+        data(c) { }
+
+    inline uint64_t match(const char& c) const
+    {
+        uint64_t output = 0;
+        for(size_t i = 0; i < CHAR_SCAN_BLOCK_SIZE; ++i)
+        {
+            if(data[i] == c) output |= uint64_t(1) << i;
+        }
+        return output;
+    }
+
+#endif
+};
+
+inline uint64_t tail_match(const char* data, const size_t& L, const char* chars, const unsigned int& N)
+{
+    uint64_t output = 0;
+    for(size_t i = 0; i < L; ++i)
+    {
+        for(size_t j = 0; j < N; ++j)
+        {
+            if(data[i] == chars[j])
+            {
+                output |= uint64_t(1) << i;
+                break;
+            }
+        }
+    }
+    return output;
+}
+
+char_scanner::char_scanner(const string& delim):
+    numDelims(0)
+{
+    for(auto& c : delim)
+    {
+        if(numDelims >= CHAR_SCAN_MAX_DELIM) break;
+        delims[numDelims] = c;
+        ++numDelims;
+    }
+}
+
+void char_scanner::scan(const char* data, const size_t& L, char_scan_mask* output) const
+{
+    size_t i = 0;
+
+    for(; i + CHAR_SCAN_BLOCK_SIZE <= L; i += CHAR_SCAN_BLOCK_SIZE, ++output)
+    {
+        scan_block block(data + i);
+
+        output->delim = 0;
+        for(size_t j = 0; j < numDelims; ++j)
+        {
+            output->delim |= block.match(delims[j]);
+        }
+
+        output->newline = block.match('\n') | block.match('\r');
+        output->quote = block.match('\"');
+    }
+
+    if(i < L)
+    {
+        output->delim = tail_match(data + i, L - i, delims, numDelims);
+        output->newline = tail_match(data + i, L - i, "\n\r", 2);
+        output->quote = tail_match(data + i, L - i, "\"", 1);
+    }
+}
+
+size_t count_chars(const char* data, const size_t& L, const char* chars)
+{
+    unsigned int N = strlen(chars);
+    if(N > CHAR_SCAN_MAX_DELIM) N = CHAR_SCAN_MAX_DELIM;
+
+    size_t output = 0, i = 0;
+    uint64_t mask;
+
+    for(; i + CHAR_SCAN_BLOCK_SIZE <= L; i += CHAR_SCAN_BLOCK_SIZE)
+    {
+        scan_block block(data + i);
+
+        mask = 0;
+        for(size_t j = 0; j < N; ++j)
+        {
+            mask |= block.match(chars[j]);
+        }
+
+        output += bit_count(mask);
+    }
+
+    if(i < L)
+    {
+        output += bit_count(tail_match(data + i, L - i, chars, N));
+    }
+
+    return output;
+}
+
+}
@@ -1,1936 +1,3547 @@
-#include "hyper/toolkit/data_stream.hpp"
-#include "hyper/toolkit/string.hpp"
-#include "hyper/toolkit/string_search.hpp"
-
-using namespace std;
-
-namespace hyperC
-{
-
-_1Dstream::_1Dstream(const _2Dstream& dataset, const unsigned int& index, const bool& row):
-    stream(nullptr),
-    readBuffer(nullptr),
-    bIsReference(dataset.isImported())
-{
-    if(bIsReference)
-    {
-        if(row)
-        {
-            dataRefs.reserve(dataset.importData[index].size());
-            for(auto& x : dataset.importData[index])
-            {
-                dataRefs.emplace_back(x);
-            }
-        }
-        else
-        {
-            dataRefs.reserve(dataset.nrow());
-            for(auto& y : dataset.importData)
-            {
-                if(index < y.size())
-                {
-                    dataRefs.emplace_back(y[index]);
-                }
-            }
-        }
-        this->entrySize = dataRefs.size();
-    }
-    else
-    {
-
-        this->streamFile = dataset.getSourceFile();
-        if(row)
-        {
-            this->entrySize = dataset.rowSize(index);
-            this->dataSizes = dataset.getRowIndexSizes(index);
-            this->dataIndex = dataset.getRowIndexPos(index);
-        }
-        else
-        {
-
-            this->entrySize = dataset.nrow();
-            this->dataSizes.reserve(dataset.nrow());
-            this->dataIndex.reserve(dataset.nrow());
-
-            for(size_t i = 0; i < dataset.nrow(); ++i)
-            {
-                if(index < dataset.rowSize(i))
-                {
-                    dataSizes.push_back(dataset.size_of(index, i));
-                    dataIndex.push_back(dataset.position(index, i));
-                }
-                else
-                {
-
-                    dataSizes.push_back(0);
-                    dataIndex.push_back(0);
-
-                }
-            }
-        }
-
-        readBuffer = new char[max(dataSizes)*10];
-        readBuffer[max(dataSizes)] = '\0';
-        openStream(this->streamFile);
-    }
-}
-
-_1Dstream::_1Dstream(const _1Dstream& stream, const vector<unsigned int>& index):
-    stream(nullptr),
-    streamFile(stream.streamFile),
-    entrySize(0),
-    bIsReference(stream.bIsReference)
-{
-    if(!bIsReference)
-    {
-        size_t L = index.size();
-        dataIndex.reserve(L);
-        dataSizes.reserve(L);
-
-        for(size_t i = 0; i < L; ++i)
-        {
-            if(index[i] >= stream.size()) continue;
-            dataIndex.push_back(stream.dataIndex[index[i]]);
-            dataSizes.push_back(stream.dataSizes[index[i]]);
-            ++entrySize;
-        }
-
-        readBuffer = new char[max(dataSizes)+1];
-        readBuffer[max(dataSizes)] = '\0';
-        openStream(streamFile);
-    }
-    else
-    {
-        size_t L = index.size();
-        dataRefs.reserve(L);
-
-        for(size_t i = 0; i < L; ++i)
-        {
-            if(index[i] >= stream.size()) continue;
-            dataRefs.push_back(stream.dataRefs[index[i]]);
-            ++entrySize;
-        }
-    }
-}
-
-_1Dstream::_1Dstream(const _1Dstream& other):
-    stream(nullptr),
-    streamFile(other.streamFile),
-    entrySize(other.entrySize),
-    dataIndex(other.dataIndex),
-    dataSizes(other.dataSizes),
-    dataRefs(other.dataRefs),
-    readBuffer(new char[max(dataSizes)+1]),
-    bIsReference(other.bIsReference)
-{
-    if(!bIsReference)
-    {
-        readBuffer[max(dataSizes)] = '\0';
-        openStream(streamFile);
-    }
-}
-_1Dstream::_1Dstream(const string& filename, const vector<uint32_t>& dataIndex, const vector<uint16_t>& dataSizes):
-    stream(nullptr),
-    streamFile(filename),
-    entrySize(dataIndex.size()),
-    dataIndex(dataIndex),
-    dataSizes(dataSizes),
-    readBuffer(new char[max(dataSizes)+1]),
-    bIsReference(false)
-{
-    readBuffer[max(dataSizes)] = '\0';
-    openStream(filename);
-}
-
-_1Dstream& _1Dstream::operator=(const _1Dstream& other)
-{
-    entrySize = other.entrySize;
-    bIsReference = other.bIsReference;
-    dataRefs = other.dataRefs;
-
-    if(!bIsReference)
-    {
-        streamFile = other.streamFile;
-        dataIndex = other.dataIndex;
-        dataSizes = other.dataSizes;
-
-        delete[] readBuffer;
-        readBuffer = new char[max(dataSizes)+1];
-        readBuffer[max(dataSizes)] = '\0';
-        memcpy(readBuffer, other.readBuffer, max(dataSizes));
-
-        openStream(streamFile);
-    }
-    return *this;
-}
-
-
-void _1Dstream::openStream(const string& streamFile)
-{
-    if(stream != nullptr)
-    {
-        reset();
-    }
-
-    if(access(streamFile.c_str(), F_OK | W_OK))
-    {
-        cout << ">> ERROR: could not open stream to " << streamFile << '\n';
-        return;
-    }
-
-    this->streamFile = streamFile;
-    stream = fopen(streamFile.c_str(), "rwb");
-}
-
-inline void _1Dstream::get(const unsigned int& i) const
-{
-    if(dataSizes[i] < 1)
-    {
-        readBuffer[0] = '\0';
-        return;
-    }
-    readBuffer[dataSizes[i]] = '\0';
-    fseek(stream, dataIndex[i], SEEK_SET);
-    fread(readBuffer, 1, dataSizes[i], stream);
-}
-
-string _1Dstream::getString(const unsigned int& i) const
-{
-    if(!bIsReference)
-    {
-        get(i);
-        string s(readBuffer);
-        processString(s);
-        return(s);
-    }
-    else
-    {
-        string s = dataRefs[i];
-        processString(s);
-        return(s);
-    }
-}
-
-float _1Dstream::getFloat(const unsigned int& i) const
-{
-    if(!bIsReference)
-    {
-        get(i);
-        if(!isNumeric(readBuffer))
-        {
-            return NAN;
-        }
-        else
-        {
-            return strtod(readBuffer, nullptr);
-        }
-    }
-    else
-    {
-        if(!isNumeric(dataRefs[i])) return NAN;
-        else return stof(dataRefs[i]);
-    }
-}
-
-void _1Dstream::import(StringVector& storage) const
-{
-    storage.reserve(storage.size() + entrySize);
-    for(size_t i = 0; i < entrySize; ++i)
-    {
-        storage.push_back(getString(i));
-    }
-}
-
-string _1Dstream::operator[](const unsigned int& i) const
-{
-    if(!bIsReference)
-    {
-        get(i);
-        string s(readBuffer);
-        processString(s);
-        return s;
-    }
-    else
-    {
-        string s = dataRefs[i];
-        processString(s);
-        return s;
-    }
-}
-
-float _1Dstream::operator()(const unsigned int& i) const
-{
-    if(!bIsReference)
-    {
-        get(i);
-        if(!isNumeric(readBuffer))
-        {
-            return NAN;
-        }
-        else
-        {
-            return strtod(readBuffer, nullptr);
-        }
-    }
-    else
-    {
-        if(!isNumeric(dataRefs[i])) return NAN;
-        else return stof(dataRefs[i]);
-    }
-}
-
-_1Dstream _1Dstream::substream(const vector<unsigned int>& index)
-{
-    return _1Dstream(*this, index);
-}
-
-_1Dstream& _1Dstream::reduce(const vector<unsigned int>& index)
-{
-    if(!bIsReference)
-    {
-        unsigned int cIndex = 0;
-        for(size_t i = 0; i < entrySize; ++cIndex)
-        {
-            if(!anyEqual(cIndex, index))
-            {
-                dataIndex.erase(dataIndex.begin() + i);
-                dataSizes.erase(dataSizes.begin() + i);
-                --entrySize;
-            }
-            else ++i;
-        }
-    }
-    else
-    {
-        unsigned int cIndex = 0;
-        for(size_t i = 0; i < entrySize; ++cIndex)
-        {
-            if(!anyEqual(cIndex, index))
-            {
-                dataRefs.erase(dataRefs.begin() + i);
-                --entrySize;
-            }
-            else ++i;
-        }
-    }
-    return *this;
-}
-
-_1Dstream _1Dstream::operator[](const vector<unsigned int>& index)
-{
-    return substream(index);
-}
-
-bool _1Dstream::check(const string& target) const
-{
-    if(!bIsReference)
-    {
-        for(size_t i = 0; i < entrySize; ++i)
-        {
-            if(cmpString(getString(i), target)) return true;
-        }
-    }
-    else
-    {
-        for(auto& data : dataRefs)
-        {
-            if(cmpString(data, target)) return true;
-        }
-    }
-    return false;
-}
-
-bool _1Dstream::find(uint_v& output, const string& target) const
-{
-    size_t L = output.size();
-    if(!bIsReference)
-    {
-        for(size_t i = 0; i < entrySize; ++i)
-        {
-            if(cmpString(getString(i), target)) output.push_back(i);
-        }
-    }
-    else
-    {
-        unsigned int i = 0;
-        for(auto& data : dataRefs)
-        {
-            if(cmpString(data, target)) output.push_back(i);
-            ++i;
-        }
-    }
-
-    return output.size() > L;
-}
-
-unsigned int _1Dstream::getIndex(const string& target) const
-{
-    uint_v coords;
-    find(coords, target);
-
-    size_t outSIZE = coords.size();
-    if(outSIZE < 1) return UINT_MAX;
-    if(outSIZE < 2) return coords.front();
-    size_t L = target.size();
-
-    unsigned int minSizeDiff = L, outIndex = 0;
-
-    if(outSIZE < 2) return coords.front();
-
-    for(size_t i = 0; i < outSIZE; ++i)
-    {
-        get(coords[i]);
-        unsigned int othercmp = charMatchNum(target, readBuffer);
-        unsigned int sizecmp = othercmp > L ? othercmp - L : L - othercmp;
-        if(sizecmp < minSizeDiff)
-        {
-            minSizeDiff = sizecmp;
-            outIndex = i;
-        }
-    }
-
-    return outIndex;
-}
-
-_2Dstream::_2Dstream():
-    stream(nullptr),
-    streamSize(0),
-    numRows(0),
-    numColumns(0),
-    readBuffer(new char[STREAM_SCAN_BUFFER_SIZE]),
-    delim("\t"),
-    cached_alignment(ORIENTATION_UNKNOWN),
-    verbose(false),
-    active(false),
-    imported(false),
-    search_index(nullptr) { }
-
-_2Dstream::_2Dstream(const string& filename,
-                     const bool& verbose,
-                     const string& delim):
-    stream(nullptr),
-    streamSize(0),
-    numRows(0),
-    numColumns(0),
-    readBuffer(new char[STREAM_SCAN_BUFFER_SIZE]),
-    delim(delim),
-    cached_alignment(ORIENTATION_UNKNOWN),
-    verbose(verbose),
-    active(false),
-    imported(false),
-    bOpen(false),
-    search_index(nullptr)
-{
-    openStream(filename, true, delim);
-}
-
-_2Dstream::_2Dstream(const _2Dstream& other):
-    stream(nullptr),
-    streamFile(other.streamFile),
-    streamSize(other.streamSize),
-    numRows(other.numRows),
-    numColumns(other.numColumns),
-    readBuffer(new char[STREAM_SCAN_BUFFER_SIZE]),
-    delim(other.delim),
-    rowSizes(other.rowSizes),
-    rowDataSizes(other.rowDataSizes),
-    indexPos(other.indexPos),
-    indexSizes(other.indexSizes),
-    importData(other.importData),
-    verbose(other.verbose),
-    active(other.active),
-    bOpen(other.bOpen),
-    imported(other.imported)
-{
-
-    if(other.search_index)
-    {
-        search_index = new hyperC::tree_vector<char, coord_string>(*other.search_index);
-    }
-    else
-    {
-        search_index = nullptr;
-    }
-
-    if(other.isOpen())
-    {
-        stream = fopen(other.streamFile.c_str(), "rb");
-    }
-    else
-    {
-        stream = nullptr;
-    }
-
-}
-
-_2Dstream::_2Dstream(string filename, vMatrix<uint32_t>& indexPos, vMatrix<uint16_t>& indexSizes,
-                     dimArray& rowSizes, dimArray& rowDataSizes,
-                     const string& delim):
-    stream(nullptr),
-    streamFile(filename),
-    numRows(rowSizes.size()),
-    numColumns(maxSize(indexPos)),
-    readBuffer(new char[STREAM_SCAN_BUFFER_SIZE]),
-    delim(delim),
-    cached_alignment(ORIENTATION_UNKNOWN),
-    rowSizes(rowSizes),
-    rowDataSizes(rowDataSizes),
-    indexPos(indexPos),
-    indexSizes(indexSizes),
-    verbose(false),
-    active(false),
-    imported(false),
-    search_index(nullptr)
-{
-    openStream(filename, false, delim);
-}
-
-_2Dstream& _2Dstream::operator=(const _2Dstream& other)
-{
-    streamFile = other.streamFile;
-    readBuffer = new char[STREAM_SCAN_BUFFER_SIZE];
-    streamSize = other.streamSize;
-    numRows = other.numRows;
-    numColumns = other.numColumns;
-    rowSizes = other.rowSizes;
-    rowDataSizes = other.rowDataSizes;
-    indexPos = other.indexPos;
-    indexSizes = other.indexSizes;
-    importData = other.importData;
-    verbose = other.verbose;
-    active = other.active;
-    bOpen = other.isOpen();
-    imported = other.imported;
-    delim = other.delim;
-
-    if(other.search_index)
-    {
-        search_index = new hyperC::tree_vector<char, coord_string>(*other.search_index);
-    }
-    else
-    {
-        search_index = nullptr;
-    }
-
-    openStream(streamFile, false, delim);
-    return *this;
-}
-
-void _2Dstream::index(const int& max_levels)
-{
-
-    if(search_index)
-    {
-        cout << "Stream is already indexed\n";
-        return;
-    }
-
-    if(stream)
-    {
-//        if(verbose)
-//        {
-            cout << "Indexing...";
-//        }
-        if(search_index)
-        {
-            delete(search_index);
-        }
-        if(!coord_index.empty())
-        {
-            coord_index.clear();
-        }
-
-        for(size_t y = 0, x; y < nrow(); ++y)
-        {
-            for(x = 0; (x < rowSize(y)) && (x < ncol()); ++x)
-            {
-                string str = getString(x, y);
-                if(!str.empty() && !isNumeric(str))
-                {
-                    to_lowercase(str);
-                    coord_index.emplace_back(str, x, y);
-                }
-            }
-        }
-
-        if(!coord_index.empty())
-        {
-            reference_vector<coord_string> refs(coord_index);
-            search_index = new tree_vector<char, coord_string>(refs, max_levels);
-
-            cout << " success\n";
-        }
-        else
-        {
-            cout << " failed\n";
-        }
-
-    }
-
-}
-
-void _2Dstream::reset()
-{
-    fclose(stream);
-    numRows = 0;
-    numColumns = 0;
-    streamSize = 0;
-    streamFile.clear();
-    rowDataSizes.clear();
-    rowSizes.clear();
-    indexPos.clear();
-    indexSizes.clear();
-    cached_alignment = ORIENTATION_UNKNOWN;
-    importData.clear();
-    imported = false;
-    bOpen = false;
-
-    delete(search_index);
-    search_index = nullptr;
-
-}
-
-void _2Dstream::reload()
-{
-    openStream(getSourceFile());
-}
-
-bool _2Dstream::openStream(const string& filename, const bool& update,
-                           const string& delim)
-{
-
-    if(stream)
-    {
-        reset();
-    }
-
-    if(access(filename.c_str(), F_OK))
-    {
-        if(verbose) cout << ">> ERROR: could not access file at " << filename << "\n";
-        return false;
-    }
-
-    if(verbose) cout << ">> Opening data stream from " << filename << '\n';
-
-    stream = fopen(filename.c_str(), "rb");
-
-    if(!stream)
-    {
-        cout << "Error opening stream to " << filename << '\n';
-        return false;
-    }
-
-    fseek(stream, 0, SEEK_END);
-    streamSize = ftell(stream);
-    fseek(stream, 0, SEEK_SET);
-
-    streamFile = filename;
-
-    // Determine the appropriate delimiter
-
-    if(delim.empty())
-    {
-        if(filename.find(".csv") < filename.size())
-        {
-            if(getCharCount(";") > getCharCount(","))
-            {
-                this->delim = ";";
-            }
-            else
-            {
-                this->delim = ",";
-            }
-        }
-        else if(filename.find(".tsv") < filename.size())
-        {
-            this->delim = "\t";
-        }
-        else
-        {
-            map<string, size_t> delim_counts;
-            delim_counts["\t"] = getCharCount("\t");
-            delim_counts[","] = getCharCount(",");
-            delim_counts[";"] = getCharCount(";");
-
-            size_t maxCount = 0,
-                   maxCountIndex = 0;
-
-            int i = 0;
-
-            for(auto& pair : delim_counts)
-            {
-                if(pair.second > maxCount)
-                {
-                    maxCount = pair.second;
-                    maxCountIndex = i;
-                }
-
-                ++i;
-            }
-
-            i = 0;
-            for(auto& pair : delim_counts)
-            {
-                if(i == maxCountIndex)
-                {
-                    this->delim = pair.first;
-                    break;
-                }
-                ++i;
-            }
-        }
-    }
-    else
-    {
-        this->delim = delim;
-    }
-
-    if(update) this->update();
-
-    if(verbose) cout << "\r>> Finished\t\t\t\n";
-
-    bOpen = true;
-
-    return true;
-}
-
-void _2Dstream::update()
-{
-
-    if(imported)
-    {
-        numRows = importData.size();
-        numColumns = maxSize(importData);
-        if(verbose) cout << ">> Updating imported stream... ";
-        for(size_t i = 0; i < numColumns; ++i)
-        {
-            if(i >= rowSizes.size()) rowSizes.push_back(importData[i].size());
-            else rowSizes[i] = importData[i].size();
-        }
-        if(verbose) cout << "done\n";
-        return;
-    }
-
-    if(nrow() > 0)
-    {
-        indexPos.clear();
-        indexSizes.clear();
-        rowSizes.clear();
-        rowDataSizes.clear();
-    }
-
-    numRows = 0;
-
-    if(!streamSize)
-    {
-        cout << "Warning: loaded stream is empty\n";
-        return;
-    }
-
-    unsigned int lastRowSize = 0;
-    unsigned long long lastIndexPos = 0ULL, lastRowIndex = 0ULL, i = 0LL;
-    thread* readout;
-
-    if(verbose)
-    {
-        readout = new thread([&]()
-        {
-            cout << ">> Updating: 0%";
-            while(i < streamSize)
-            {
-                cout << "\r>> Updating: " << i << "b / " <<
-                     streamSize << "b (" << (unsigned int)(float(i)/streamSize*100) << "%)";
-                this_thread::sleep_for(chrono::duration<float>(DATA_READOUT_REFRESH));
-            }
-        });
-    }
-
-    fseek(stream, 0, SEEK_SET);
-
-    char* c = readBuffer;
-    unsigned long long bufferPos = 0ULL;
-    bool bNewLine = true;
-    bool bQuote = false;
-
-    for(; i < streamSize; ++i, ++c)
-    {
-
-        if(bufferPos <= i)
-        {
-            unsigned int bufferSize = STREAM_SCAN_BUFFER_SIZE > streamSize - i ? streamSize - i : STREAM_SCAN_BUFFER_SIZE;
-            bufferPos += bufferSize;
-            fread(readBuffer, 1, bufferSize, stream);
-
-            c = readBuffer;
-        }
-
-        if(*c == '\"')
-        {
-            bQuote = !bQuote;
-        }
-        else if(!bQuote)
-        {
-            if((*c == '\n') || (*c == '\r'))
-            {
-
-                ++rowSizes.back();
-
-                indexSizes.back().push_back(i-lastIndexPos);
-                indexPos.back().push_back(lastIndexPos);
-                rowDataSizes.back() = i - lastRowIndex;
-
-                if(i < streamSize - 1)
-                {
-                    if((*c + 1) && ((*(c + 1) == '\r')))
-                    {
-                        lastIndexPos = i+2;
-                        lastRowIndex = i+2;
-                        ++i;
-                        ++c;
-                    }
-                    if((*c + 1) && ((*(c + 1) == '\n')))
-                    {
-                        lastIndexPos = i+2;
-                        lastRowIndex = i+2;
-                        ++i;
-                        ++c;
-                    }
-                    else
-                    {
-                        lastIndexPos = i+1;
-                        lastRowIndex = i+1;
-                    }
-                }
-
-                bNewLine = true;
-
-            }
-            else if(isCharType(*c, delim))
-            {
-
-                indexPos.back().push_back(lastIndexPos);
-                indexSizes.back().push_back(i-lastIndexPos);
-
-                ++rowSizes.back();
-
-                if(*(c + 1) && (*(c + 1) == '\r'))
-                {
-                    lastIndexPos = i+2;
-                    ++i;
-                    ++c;
-                }
-                else
-                {
-                    lastIndexPos = i+1;
-                }
-            }
-        }
-
-        if((i < streamSize - 1) && bNewLine)
-        {
-            ++numRows;
-
-            indexSizes.emplace_back();
-            indexPos.emplace_back();
-            rowSizes.emplace_back(0);
-            rowDataSizes.emplace_back(0);
-
-            bNewLine = false;
-        }
-
-    }
-    if(i > lastIndexPos)
-    {
-        indexSizes.back().push_back(i-lastIndexPos);
-        indexPos.back().push_back(lastIndexPos);
-        rowDataSizes.push_back(i-lastRowIndex);
-    }
-    numColumns = max(rowSizes);
-
-    if(verbose)
-    {
-        if(readout->joinable()) readout->join();
-        delete(readout);
-        cout << "\r>> Updating: " << streamSize << "b / " <<
-             streamSize << "b (100%)\n";
-    }
-}
-
-unsigned int _2Dstream::maxRowSize() const noexcept
-{
-    return max(rowSizes);
-}
-
-size_t _2Dstream::getCharCount(const string& chars) const
-{
-
-    fpos_t streamPos = ftell(stream);
-
-    fseek(stream, 0, SEEK_SET);
-    char* c = readBuffer;
-    unsigned long long bufferPos = 0;
-    unsigned int bufferSize = 0;
-    size_t output = 0;
-
-    for(size_t coord = 0; coord < streamSize; ++coord)
-    {
-        if(bufferPos <= coord)
-        {
-            bufferSize = STREAM_SCAN_BUFFER_SIZE > streamSize - coord ? streamSize - coord : STREAM_SCAN_BUFFER_SIZE;
-            bufferPos += bufferSize;
-            fread(readBuffer, 1, bufferSize, stream);
-            c = readBuffer;
-        }
-
-        if(isCharType(*c, chars))
-        {
-            ++output;
-        }
-
-        ++c;
-    }
-
-    fsetpos(stream, &streamPos);
-
-    return output;
-
-}
-
-unsigned int _2Dstream::colSize(const unsigned int& col) const
-{
-    unsigned int output = 0;
-    for(auto& row : rowSizes)
-    {
-        if(col < row)
-        {
-            ++output;
-        }
-    }
-
-    return output;
-}
-
-inline void _2Dstream::get(const unsigned int& x, const unsigned int& y) const
-{
-    if(!indexSizes[y][x])
-    {
-        readBuffer[0] = '\0';
-        return;
-    }
-
-    readBuffer[indexSizes[y][x]] = '\0';
-    fseek(stream, indexPos[y][x], SEEK_SET);
-    fread(readBuffer, 1, indexSizes[y][x], stream);
-
-}
-
-_1Dstream _2Dstream::getCol(const unsigned int& col) const
-{
-    return _1Dstream(*this, col, false);
-}
-
-size_t _2Dstream::column_index(const string& header) const
-{
-
-    if(nrow() < 1)
-    {
-        throw out_of_range("_2Dstream::column_index(): requested on empty stream");
-    }
-
-    for(size_t i = 0; i < rowSize(0); ++i)
-    {
-        if(getString(i, 0) == header)
-        {
-            return i;
-        }
-    }
-
-    throw out_of_range("_2Dstream::column_index(): header \"" + header + "\" does not exist");
-
-}
-
-size_t _2Dstream::row_index(const string& row_name) const
-{
-
-    if(empty() || (ncol() < 1))
-    {
-        throw out_of_range("_2Dstream::row_index(): requested on empty stream");
-    }
-
-    for(size_t i = 0, L = nrow(); i < L; ++i)
-    {
-        if(getString(0, i) == row_name)
-        {
-            return i;
-        }
-    }
-
-    throw out_of_range("_2Dstream::row_index(): row_name \"" + row_name + "\" does not exist");
-
-}
-
-void _2Dstream::importCol(StringVector& storage, const unsigned int& col) const
-{
-    storage.reserve(storage.size() + numRows);
-    if(!imported)
-    {
-        for(size_t i = 0; i < numRows; ++i)
-        {
-            if(col >= rowSizes[i]) continue;
-            storage.push_back(getString(col, i));
-        }
-    }
-    else
-    {
-        for(size_t i = 0; i < nrow(); ++i)
-        {
-            if(col >= rowSizes[i]) continue;
-            storage.push_back(importData[i][col]);
-        }
-    }
-}
-
-void _2Dstream::importRow(StringVector& storage, const unsigned int& row) const
-{
-    if(!imported)
-    {
-        storage.reserve(storage.size() + rowSizes[row]);
-        size_t L = rowSizes[row];
-        for(size_t i = 0; i < L; ++i)
-        {
-            storage.push_back(getString(i, row));
-        }
-    }
-    else
-    {
-        storage = importData[row];
-    }
-}
-
-void _2Dstream::import()
-{
-    if(imported) update();
-
-    importData.clear();
-    importData.resize(numRows);
-    for(size_t i = 0; i < numRows; ++i)
-    {
-        importRow(importData[i], i);
-        if(verbose) cout << "\r>> Importing stream: " << i*100/numRows << "%";
-    }
-    if(verbose) cout << ">> Importing stream: 100%\n";
-    imported = true;
-
-    fclose(stream);
-    stream = nullptr;
-    delete[] readBuffer;
-    readBuffer = nullptr;
-    indexPos.clear();
-    indexSizes.clear();
-}
-
-void _2Dstream::release()
-{
-    if(verbose) cout << ">> Releasing stream data ... ";
-    imported = false;
-    importData.clear();
-
-    readBuffer = new char[STREAM_SCAN_BUFFER_SIZE];
-    openStream(streamFile);
-    update();
-    if(verbose) cout << "complete\n";
-}
-
-string _2Dstream::getString(const unsigned int& x, const unsigned int& y) const
-{
-    if(!imported)
-    {
-        get(x, y);
-        string s(readBuffer);
-        processString(s);
-        return s;
-    }
-    else
-    {
-        string s = importData[y][x];
-        processString(s);
-        return s;
-    }
-}
-
-float _2Dstream::getFloat(const unsigned int& x, const unsigned int& y) const
-{
-    if(!imported)
-    {
-        get(x, y);
-        if(!isNumeric(readBuffer))
-        {
-            return NAN;
-        }
-        else
-        {
-            return strtod(readBuffer, nullptr);
-        }
-    }
-    else
-    {
-        if(isNumeric(importData[y][x])) return stof(importData[y][x]);
-        else return NAN;
-    }
-}
-
-_1Dstream _2Dstream::getRow(const unsigned int& row) const
-{
-    return _1Dstream(*this, row, true);
-}
-
-_1Dstream _2Dstream::operator[](const unsigned int& row) const
-{
-    return _1Dstream(*this, row, true);
-}
-
-_2Dstream _2Dstream::operator[](const vector<unsigned int>& rows) const
-{
-    size_t L = rows.size();
-
-    vMatrix<uint32_t> newIndexPos;
-    vMatrix<uint16_t> newIndexSizes;
-    dimArray newRowSizes;
-    dimArray newRowDataSizes;
-
-    newIndexPos.reserve(L);
-    newIndexSizes.reserve(L);
-    newRowSizes.reserve(L);
-    newRowDataSizes.reserve(L);
-
-    for(size_t i = 0; i < L; ++i)
-    {
-        newIndexPos.emplace_back(indexPos[rows[i]]);
-        newIndexSizes.emplace_back(indexSizes[rows[i]]);
-        newRowSizes.push_back(newIndexSizes.back().size());
-        newRowDataSizes.push_back(sum(newIndexSizes.back()));
-    }
-
-    return _2Dstream(streamFile, newIndexPos, newIndexSizes, newRowSizes, newRowDataSizes, "");
-}
-
-_2Dstream _2Dstream::operator[](const VectorPairU& bounds) const
-{
-
-    size_t L = bounds.y.size();
-
-    vMatrix<uint32_t> newIndexPos;
-    vMatrix<uint16_t> newIndexSizes;
-    dimArray newRowSizes;
-    dimArray newRowDataSizes;
-
-    newIndexPos.reserve(L);
-    newIndexSizes.reserve(L);
-    newRowSizes.reserve(L);
-    newRowDataSizes.reserve(L);
-
-    for(size_t i = 0; i < L; ++i)
-    {
-        newIndexPos.emplace_back(at_index(indexPos[bounds.y[i]], bounds.x));
-        newIndexSizes.emplace_back(at_index(indexSizes[bounds.y[i]], bounds.x));
-        newRowSizes.push_back(newIndexSizes.back().size());
-        newRowDataSizes.push_back(sum(newIndexSizes.back()));
-    }
-
-    return _2Dstream(streamFile, newIndexPos, newIndexSizes, newRowSizes, newRowDataSizes, "");
-}
-
-bool _2Dstream::check(const string& target, const float& size_threshold,
-                      const float& match_threshold) const
-{
-
-    // Use the pre-assembled search index if available
-
-    if(search_index)
-    {
-        try
-        {
-
-            string case_target = target;
-            to_lowercase(case_target);
-
-            return search_index->search(case_target);
-
-        }
-        catch(...)
-        {
-            return false;
-        }
-    }
-
-    // Case-insensitive Boyer-Moore search
-
-    if(!imported)
-    {
-
-        if(match_threshold == 1.0f)
-        {
-
-            size_t L = target.size();
-            if(L > streamSize) return false;
-
-            vector<size_t> char_table;
-            vector<size_t> match_table;
-
-            boyer_moore_char_table(target, char_table, true);
-            boyer_moore_match_table(target, match_table, true);
-
-            fseek(stream, 0, SEEK_SET);
-
-            unsigned long long matchCoord = 0;
-            unsigned long long bufferPos = 0;
-            unsigned long long matchCheck;
-
-            char* match_c = readBuffer;
-
-            unsigned int bufferSize = 0;
-            unsigned int strSize;
-            unsigned int maxStrSize = L/size_threshold;
-
-            do
-            {
-
-                // 2048b overlap to account for boundary matches
-                bufferSize = STREAM_SCAN_BUFFER_SIZE > streamSize - bufferPos ? streamSize - bufferPos : STREAM_SCAN_BUFFER_SIZE - 2048;
-
-                fread(readBuffer, 1, bufferSize, stream);
-
-                matchCheck = boyer_moore_search(target.c_str(), match_c, char_table, match_table, true);
-
-                if(matchCheck != UINT_MAX) // Match found in the stream segment
-                {
-
-                    match_c = readBuffer + matchCheck; // Roll forward to check for redundant matches
-
-                    if(bufferPos + matchCheck > matchCoord) // Account for repetitions in the overlap region
-                    {
-
-                        matchCoord = bufferPos + matchCheck;
-
-                        // Check the size against requirements
-
-                        strSize = getStrSize(match_c);
-
-                        if(strSize <= maxStrSize)
-                        {
-
-                            return true;
-
-                        }
-
-                    }
-
-
-                }
-
-                bufferPos += bufferSize;
-
-            }
-            while(bufferPos + bufferSize < streamSize);
-
-        }
-        else
-        {
-
-            // Brute force search for partial string matches
-
-            size_t L = target.size();
-
-            unsigned long long coord = 0;
-            unsigned long long bufferPos = 0;
-
-            unsigned int matchCoord = 0;
-            unsigned int initCoord = 0;
-            unsigned int sizeFactor = L/size_threshold;
-            unsigned int matchFactor = L*match_threshold;
-            unsigned int bufferSize = 0;
-
-            char* c = readBuffer;
-
-            // Initialize the trim
-
-            while(matchCoord < L)
-            {
-                if(isSpecial(target[matchCoord])) ++matchCoord;
-                else
-                {
-                    initCoord = matchCoord;
-                    matchCoord = L-1;
-                    break;
-                }
-            }
-
-            while(matchCoord > initCoord + 1)
-            {
-                if(isSpecial(target[matchCoord]))
-                {
-                    --L;
-                    --matchCoord;
-                }
-                else
-                {
-                    break;
-                }
-            }
-
-            L-= initCoord;
-            if(L < 1) L = target.size();
-            if(initCoord >= L-1) initCoord = 0;
-
-            if(L > streamSize) return false;
-            size_t S = streamSize - L + 1;
-
-            matchCoord = initCoord;
-
-            fseek(stream, 0, SEEK_SET);
-
-            // Perform the search
-
-            for(; coord < S; ++coord)
-            {
-                if(bufferPos <= coord)
-                {
-                    bufferSize = STREAM_SCAN_BUFFER_SIZE > streamSize - coord ? streamSize - coord : STREAM_SCAN_BUFFER_SIZE;
-                    bufferPos += bufferSize;
-                    fread(readBuffer, 1, bufferSize, stream);
-                    c = readBuffer;
-                }
-
-                if(*c == target[matchCoord])
-                {
-                    ++matchCoord;
-                }
-                else if(isLowerCase(*c))
-                {
-                    if((*c - 32) == target[matchCoord])
-                    {
-                        ++matchCoord;
-                    }
-                }
-                else if(isUpperCase(*c))
-                {
-                    if((*c + 32) == target[matchCoord])
-                    {
-                        ++matchCoord;
-                    }
-                }
-                else if(matchCoord >= matchFactor)
-                {
-                    if(getStrSize(c) <= sizeFactor)
-                    {
-                        return true;
-                    }
-                    matchCoord = initCoord;
-                }
-                else matchCoord = initCoord;
-                ++c;
-            }
-        }
-
-    }
-    else
-    {
-        size_t sizeFactor = target.size()/size_threshold;
-        for(const auto& y : importData)
-        {
-            for(const auto& x : y)
-            {
-                if((sizeFactor > x.size()) && cmpString(target, x)) return true;
-            }
-        }
-    }
-
-    return false;
-}
-
-bool _2Dstream::find(VectorPairU& output, const string& target, const float& size_threshold,
-                     const float& match_threshold)
-{
-
-    if(target.empty())
-    {
-        return false;
-    }
-
-    // Use the pre-assembled search index if available
-
-    if(search_index)
-    {
-        try
-        {
-
-            string case_target = target;
-            to_lowercase(case_target);
-
-            vector<coord_string> search_results;
-            search_index->get_equal(case_target, search_results);
-
-            if(!search_results.empty())
-            {
-                for(auto& result : search_results)
-                {
-                    output.emplace_back(result.coords);
-                }
-
-                return true;
-            }
-
-            return false;
-
-        }
-        catch(...)
-        {
-            return false;
-        }
-    }
-
-    unsigned int initSIZE = output.size();
-
-    // If all else fails, perform a linear string search
-
-    if(!imported)
-    {
-
-        if(match_threshold == 1.0f)
-        {
-
-            // Case-insensitive Boyer-Moore search for exact length matches
-
-            size_t L = target.size();
-            if(L > streamSize) return false;
-
-            vector<size_t> char_table;
-            vector<size_t> match_table;
-
-            boyer_moore_char_table(target, char_table, true);
-            boyer_moore_match_table(target, match_table, true);
-
-            fseek(stream, 0, SEEK_SET);
-
-            unsigned long long matchCoord = 0;
-            unsigned long long bufferPos = 0;
-            unsigned long long matchCheck;
-
-            char* match_c = readBuffer;
-
-            unsigned int bufferSize = 0;
-            unsigned int strSize;
-            unsigned int maxStrSize = L/size_threshold;
-
-            do
-            {
-
-                // 2048b overlap to account for boundary matches
-                bufferSize = STREAM_SCAN_BUFFER_SIZE > streamSize - bufferPos ? streamSize - bufferPos : STREAM_SCAN_BUFFER_SIZE - 2048;
-
-                fread(readBuffer, 1, bufferSize, stream);
-                match_c = readBuffer;
-
-                size_t i = 0;
-
-                // Search along the stream segment until no match is found
-
-                while((matchCheck = boyer_moore_search(target.c_str(), match_c, char_table, match_table, true)) != UINT_MAX)
-                {
-
-                    match_c += matchCheck + L; // Roll forward to check for redundant matches
-                    i += matchCheck;
-
-                    if(bufferPos + i > matchCoord) // Account for repetitions in the overlap region
-                    {
-
-                        matchCoord = bufferPos + i;
-
-                        // Check the size against requirements
-
-                        strSize = getStrSize(match_c);
-
-                        if(strSize <= maxStrSize)
-                        {
-
-                            // Register the index of this find
-
-                            for(size_t y = 1; y < nrow(); ++y)
-                            {
-                                if(indexPos[y].front() > matchCoord)
-                                {
-
-                                    for(int x = rowSize(y-1) - 1; x >= 0; --x)
-                                    {
-                                        if(indexPos[y-1][x] <= matchCoord)
-                                        {
-                                            output.emplace_back((size_t)x, y-1);
-
-                                            break;
-                                        }
-                                    }
-
-                                    break;
-                                }
-                            }
-
-                        }
-
-                    }
-
-                    i += L;
-
-                }
-
-                bufferPos += bufferSize;
-
-            }
-            while(bufferPos + bufferSize < streamSize);
-
-        }
-        else
-        {
-
-            // Brute force search for partial string matches
-
-            size_t L = target.size();
-
-            unsigned long long coord = 0;
-            unsigned long long bufferPos = 0;
-
-            unsigned int matchCoord = 0;
-            unsigned int initCoord = 0;
-
-            unsigned int bufferSize = 0;
-
-            char* c = readBuffer;
-
-            // Initialize the trim
-
-            while((matchCoord < L) && (L > 0))
-            {
-                if(isSpecial(target[matchCoord]))
-                {
-                    ++matchCoord;
-                    --L;
-                }
-                else
-                {
-                    initCoord = matchCoord;
-                    matchCoord = L-1;
-                    break;
-                }
-            }
-
-            while((matchCoord > initCoord + 1) && (L > 0))
-            {
-                if(isSpecial(target[matchCoord]))
-                {
-                    --L;
-                    --matchCoord;
-                }
-                else
-                {
-                    break;
-                }
-            }
-
-            L-= initCoord;
-            if(L < 1) L = target.size();
-            if(initCoord >= L-1) initCoord = 0;
-
-            if(L > streamSize) return false;
-            size_t S = streamSize - L + 1;
-
-            matchCoord = initCoord;
-
-            unsigned int sizeFactor;
-            if(L > 3) sizeFactor = L/size_threshold;
-            else sizeFactor = L;
-
-            unsigned int matchFactor;
-            if(L > 3) matchFactor = L*match_threshold;
-            else matchFactor = L;
-
-            fseek(stream, 0, SEEK_SET);
-
-            // Perform the search
-
-            if(!L) return false;
-
-            for(; coord < S; ++coord)
-            {
-
-                if(bufferPos <= coord)
-                {
-                    bufferSize = STREAM_SCAN_BUFFER_SIZE > streamSize - coord ? streamSize - coord : STREAM_SCAN_BUFFER_SIZE;
-                    bufferPos += bufferSize;
-                    fread(readBuffer, 1, bufferSize, stream);
-                    c = readBuffer;
-                }
-
-                if(*c == target[matchCoord])
-                {
-                    ++matchCoord;
-                }
-                else if(isLowerCase(*c))
-                {
-                    if((*c - 32) == target[matchCoord])
-                    {
-                        ++matchCoord;
-                    }
-                }
-                else if(isUpperCase(*c))
-                {
-                    if((*c + 32) == target[matchCoord])
-                    {
-                        ++matchCoord;
-                    }
-                }
-                else if(matchCoord >= matchFactor)
-                {
-
-                    if(getStrSize(c) <= sizeFactor)
-                    {
-                        output.x.push_back(0);
-                        output.y.push_back(0);
-                        while((output.y.back() < nrow() - 1) && (coord > indexPos[output.y.back()].front() + rowDataSizes[output.y.back()]))
-                        {
-                            ++output.y.back();
-                        }
-                        while((output.x.back() < rowSize(output.y.back()) - 1) && (coord > indexPos[output.y.back()][output.x.back()+1]))
-                        {
-                            ++output.x.back();
-                        }
-                    }
-
-                    matchCoord = initCoord;
-                }
-                else matchCoord = initCoord;
-                ++c;
-            }
-
-        }
-
-    }
-    else
-    {
-        unsigned int xCoord, yCoord = 0;
-        unsigned int sizeFactor = target.size()/size_threshold;
-
-        for(const auto& y : importData)
-        {
-            xCoord = 0;
-            for(const auto& x : y)
-            {
-                if((sizeFactor > x.size()) && cmpString(target, x))
-                {
-                    output.x.push_back(xCoord);
-                    output.y.push_back(yCoord);
-                }
-                ++xCoord;
-            }
-            ++yCoord;
-        }
-    }
-
-    return output.size() > initSIZE;
-
-}
-
-Vector2u _2Dstream::getCoords(const string& target, const float& threshold)
-{
-    VectorPairU coords;
-    find(coords, target);
-
-    size_t outSIZE = coords.size();
-    if(outSIZE < 1) return Vector2u(UINT_MAX,UINT_MAX);
-    if(outSIZE < 2) return Vector2u(coords.x.front(), coords.y.front());
-    size_t L = target.size();
-
-    unsigned int minSizeDiff = L, outIndex = 0;
-
-    for(size_t i = 0; i < outSIZE; ++i)
-    {
-        get(coords.x[i], coords.y[i]);
-        unsigned int othercmp = charMatchNum(target, readBuffer);
-        unsigned int sizecmp = othercmp > L ? othercmp - L : L - othercmp;
-        if(sizecmp < minSizeDiff)
-        {
-            minSizeDiff = sizecmp;
-            outIndex = i;
-        }
-    }
-
-    return Vector2u(coords.x[outIndex], coords.y[outIndex]);
-}
-
-unsigned int _2Dstream::findRow(const string& query,
-                                const float& size_threshold)
-{
-
-    Vector2u best_coords = getCoords(query, size_threshold);
-
-    if(best_coords.y >= nrow())
-    {
-        throw std::out_of_range("_2Dstream::findRow(): query not found in stream");
-    }
-
-    return best_coords.y;
-
-}
-
-unsigned int _2Dstream::findCol(const string& query,
-                                const float& size_threshold)
-{
-
-    Vector2u best_coords = getCoords(query, size_threshold);
-
-    if(best_coords.x >= ncol())
-    {
-        throw std::out_of_range("_2Dstream::findCol(): query not found in stream");
-    }
-
-    return best_coords.x;
-
-}
-
-string _2Dstream::findMatch(const string& target, const float& threshold)
-{
-    VectorPairU coords;
-    find(coords, target, threshold);
-
-    if(coords.empty()) return string();
-
-    size_t outSIZE = coords.size();
-    if(outSIZE < 2) return getString(coords.x.front(), coords.y.front());
-    size_t L = target.size();
-
-    std::vector<std::string> candidates;
-    candidates.reserve(coords.size());
-
-    for(size_t i = 0; i < coords.size(); ++i)
-    {
-        candidates.emplace_back(getString(coords[i]));
-    }
-
-    return getBestStringMatch(target, candidates);
-}
-
-unsigned int _2Dstream::getCount(const string& query, bool exact, const float& threshold)
-{
-    unsigned int output = 0;
-    VectorPairU coords;
-    find(coords, query, threshold);
-
-    size_t L = coords.size();
-
-    if(exact)
-    {
-        for(size_t i = 0; i < L; ++i)
-        {
-            if(getString(coords[i]) == query)
-            {
-                ++output;
-            }
-        }
-    }
-    else
-    {
-        output = coords.size();
-    }
-
-    return output;
-}
-
-bool isNumeric(const _1Dstream& stream, const unsigned int index)
-{
-    stream.get(index);
-    bool output = isNumeric(stream.readbuf());
-    return output;
-}
-
-string getMatchingString(const string& query, _2Dstream& stream)
-{
-    VectorPairU coords;
-    stream.find(coords, query);
-    Vector2u matchCoords = getBestStreamMatch(coords, stream, query);
-    return stream.getString(matchCoords.x, matchCoords.y);
-}
-
-Vector2u getBestStreamMatch(VectorPairU& coords,
-                            _2Dstream& stream,
-                            const string& target,
-                            const unsigned char& params,
-                            const float& threshold)
-{
-
-    if(coords.empty()) return Vector2u(UINT_MAX, UINT_MAX);
-
-    size_t outSIZE = coords.size(), L = target.size();
-    unsigned int minSizeDiff = L, outIndex = 0;
-
-    vector<string> candidates;
-
-    if(!stream.isImported())
-    {
-        for(size_t i = 0; i < outSIZE; ++i)
-        {
-            candidates.emplace_back(stream.getString(coords[i]));
-        }
-    }
-    else
-    {
-        for(size_t i = 0; i < outSIZE; ++i)
-        {
-            candidates.emplace_back(stream.importData[coords.y[i]][coords.x[i]]);
-        }
-    }
-
-    unsigned int matchIndex = getMatchingIndex(target, candidates, params, threshold);
-
-    if(matchIndex != UINT_MAX)
-    {
-        return coords[matchIndex];
-    }
-
-    return Vector2u(UINT_MAX, UINT_MAX);
-}
-
-void getBestStreamMatchCoords(VectorPairU& coords, _2Dstream& stream, const string& target)
-{
-    size_t outSIZE = coords.size();
-    if(outSIZE < 2) return;
-    size_t L = target.size();
-
-    vector<string> candidates;
-    for(size_t i = 0; i < outSIZE; ++i)
-    {
-        candidates.emplace_back(stream.getString(coords[i]));
-    }
-
-    unsigned int matchIndex = getMatchingIndex(target, candidates, CMP_STR_DEFAULT | CMP_STR_SW, 0.4);
-
-    if(matchIndex != UINT_MAX)
-    {
-
-        string bestMatch = candidates[matchIndex];
-
-        for(size_t i = 0, j = 0; i < outSIZE; ++j)
-        {
-            if(candidates[j] != bestMatch)
-            {
-                coords.erase(i);
-                --outSIZE;
-            }
-            else ++i;
-        }
-    }
-
-
-}
-
-bool filterStreamMatch(StringVector& prompt, _2Dstream& stream, bool getMatches)
-{
-    for(size_t i = 0; i < prompt.size();)
-    {
-        if(getMatches)
-        {
-            prompt[i] = stream.findMatch(prompt[i]);
-            if(prompt[i].size() < 1) prompt.erase(prompt.begin() + i);
-            else ++i;
-        }
-        else if(!getMatches && !stream.check(prompt[i])) prompt.erase(prompt.begin() + i);
-        else ++i;
-    }
-    return prompt.size() > 0;
-}
-
-bool checkAnyStreamMatch(StringVector& query, _2Dstream& stream, bool getMatches)
-{
-    bool output = false;
-    for(auto& tag : query)
-    {
-        if(getMatches)
-        {
-            string matchStr = stream.findMatch(tag);
-            if(matchStr.size() > 0)
-            {
-                tag = matchStr;
-                output = true;
-            }
-        }
-        else
-        {
-            if(stream.check(tag)) return true;
-        }
-    }
-    return output;
-}
-
-ByteNum assessCoordAlignment(const VectorPairU& coords, _2Dstream& dataSource)
-{
-
-    float orientationX = 0.0f,
-          orientationY = 0.0f,
-          yCTR = (float)dataSource.nrow()/2,
-          xCTR = (float)dataSource.ncol()/2;
-
-    size_t tSIZE = coords.size();
-
-    if(tSIZE < 1) return ORIENTATION_NONE;
-
-    for(size_t i = 0; i < tSIZE; ++i)
-    {
-        orientationX += absolute((float)(coords.x[i]) - xCTR)/dataSource.nrow();
-        orientationY += absolute((float)(coords.y[i]) - yCTR)/dataSource.ncol();
-    }
-
-    orientationX /= numUnique(coords.x);
-    orientationY /= numUnique(coords.y);
-
-    if(orientationX > orientationY) return ORIENTATION_COLUMN; // Horizontal distribution is more diffuse
-    if(orientationY > orientationX) return ORIENTATION_ROW; // Vertical distribution is more diffuse
-
-    return ORIENTATION_NONE;
-}
-
-ByteNum assessCoordAlignment(const VectorPairU& inCoords, const VectorPairU& outCoords)
-{
-    size_t L1 = inCoords.size(), L2 = outCoords.size();
-
-    if((L1 < 1) || (L2 < 1)) return ORIENTATION_NONE;
-
-    size_t xMatch = 0, yMatch = 0;
-
-    for(size_t i = 0; i < L1; ++i)
-    {
-        if(anyEqual(inCoords.x[i], outCoords.x)) ++xMatch;
-        if(anyEqual(inCoords.y[i], outCoords.y)) ++yMatch;
-    }
-
-    if(xMatch > yMatch) return ORIENTATION_ROW;
-    if(yMatch > xMatch) return ORIENTATION_COLUMN;
-
-    return ORIENTATION_NONE;
-}
-
-ByteNum assessCoordAlignment(const VectorPairU& coords)
-{
-    size_t xUnique = numUnique(coords.x);
-    size_t yUnique = numUnique(coords.y);
-
-    if(xUnique > yUnique) return ORIENTATION_ROW;
-    if(yUnique > xUnique) return ORIENTATION_COLUMN;
-
-    return ORIENTATION_NONE;
-}
-
-ByteNum getSearchOrientation(const string& query, _2Dstream& stream)
-{
-    VectorPairU coords;
-    stream.find(coords, query);
-    return assessCoordAlignment(coords, stream);
-}
-
-}
+#include "hyper/toolkit/data_stream.hpp"
+#include "hyper/toolkit/string.hpp"
+#include "hyper/toolkit/string_search.hpp"
+
+#include <atomic>
+#include <iterator>
+#include <mutex>
+
+#if !(defined WIN32 || defined _WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#endif
+
+using namespace std;
+
+namespace hyperC
+{
+
+stream_map::stream_map(const string& filename):
+    mapData(nullptr),
+    mapSize(0)
+{
+#if !(defined WIN32 || defined _WIN32)
+
+    int fd = open(filename.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+        return;
+    }
+
+    struct stat fileStat;
+    if(!fstat(fd, &fileStat) && (fileStat.st_size > 0))
+    {
+        void* region = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if(region != MAP_FAILED)
+        {
+            mapData = (const char*)region;
+            mapSize = fileStat.st_size;
+        }
+    }
+
+    ::close(fd); // The mapping remains valid after the descriptor is closed
+
+#endif
+}
+
+stream_map::~stream_map()
+{
+#if !(defined WIN32 || defined _WIN32)
+    if(mapData)
+    {
+        munmap((void*)mapData, mapSize);
+    }
+#endif
+}
+
+// Size of the cell surrounding c, bounded to the mapped region
+
+inline unsigned int mapped_cell_size(const char* begin, const char* end, const char* c,
+                                     const string& delim)
+{
+    const char* first = c, *last = c;
+    while((first > begin) && !isCharType(*(first - 1), delim) &&
+          (*(first - 1) != '\n') && (*(first - 1) != '\r'))
+    {
+        --first;
+    }
+    while((last < end) && !isCharType(*last, delim) &&
+          (*last != '\n') && (*last != '\r'))
+    {
+        ++last;
+    }
+    return last - first;
+}
+
+/*
+    Positional reads for const accessors.  These never move the shared file
+    position, and scratch space is held per thread, so any number of threads
+    may read from one opened stream at once.
+*/
+
+size_t read_stream(FILE* stream, char* output, const unsigned long long& pos, const size_t& L)
+{
+#if defined WIN32 || defined _WIN32
+
+    static mutex readMutex; // No pread - serialize seek and read instead
+    lock_guard<mutex> lock(readMutex);
+
+    _fseeki64(stream, pos, SEEK_SET);
+    return fread(output, 1, L, stream);
+
+#else
+
+    size_t output_size = 0;
+    ssize_t bytesRead;
+    while(output_size < L)
+    {
+        bytesRead = pread(fileno(stream), output + output_size, L - output_size, pos + output_size);
+        if(bytesRead <= 0) break;
+        output_size += bytesRead;
+    }
+    return output_size;
+
+#endif
+}
+
+// Per-thread buffer for a single cell, valid until the next cell read on the same thread
+
+inline char* cell_buffer(const size_t& L)
+{
+    thread_local vector<char> buffer;
+    if(buffer.size() < L) buffer.resize(L);
+    return buffer.data();
+}
+
+// Per-thread buffer for stream scans
+
+inline char* scan_buffer()
+{
+    thread_local vector<char> buffer(STREAM_SCAN_BUFFER_SIZE);
+    return buffer.data();
+}
+
+const char* read_cell(const stream_map* mapping, FILE* stream,
+                      const unsigned long long& pos, const size_t& L)
+{
+    char* output = cell_buffer(L + 1);
+    if(mapping)
+    {
+        memcpy(output, mapping->at(pos), L);
+        output[L] = '\0';
+    }
+    else if(stream)
+    {
+        output[read_stream(stream, output, pos, L)] = '\0';
+    }
+    else
+    {
+        output[0] = '\0';
+    }
+    return output;
+}
+
+/*
+    Batched reads for views of a buffered stream.  Cells are collected with
+    add() and read by fill() into a single per-thread buffer: one positional
+    read when the cells are dense in the file, otherwise one read per cell.
+*/
+
+struct stream_view_batch
+{
+    vector<uint64_t>    positions;
+    vector<uint64_t>    sizes;
+    uint64_t            first;
+    uint64_t            last;
+    uint64_t            total;
+
+    stream_view_batch():
+        first(UINT64_MAX),
+        last(0),
+        total(0) { }
+
+    inline void add(const uint64_t& pos, const uint64_t& size)
+    {
+        positions.push_back(pos);
+        sizes.push_back(size);
+        if(!size) return;
+        if(pos < first) first = pos;
+        if(pos + size > last) last = pos + size;
+        total += size;
+    }
+
+    void fill(FILE* stream, vector<string_view>& output) const
+    {
+        thread_local vector<char> buffer;
+
+        const size_t L = positions.size();
+        output.reserve(output.size() + L);
+
+        if(!total)
+        {
+            output.resize(output.size() + L);
+            return;
+        }
+
+        if(last - first <= 2*total + STREAM_SCAN_BUFFER_SIZE)
+        {
+            if(buffer.size() < last - first) buffer.resize(last - first);
+            read_stream(stream, buffer.data(), first, last - first);
+
+            for(size_t i = 0; i < L; ++i)
+            {
+                output.emplace_back(sizes[i] ? buffer.data() + (positions[i] - first) : nullptr, sizes[i]);
+            }
+        }
+        else
+        {
+            if(buffer.size() < total) buffer.resize(total);
+
+            char* c = buffer.data();
+            for(size_t i = 0; i < L; ++i)
+            {
+                read_stream(stream, c, positions[i], sizes[i]);
+                output.emplace_back(c, sizes[i]);
+                c += sizes[i];
+            }
+        }
+    }
+};
+
+_1Dstream::_1Dstream(const _2Dstream& dataset, const unsigned int& index, const bool& row):
+    stream(nullptr),
+    mapping(dataset.getMapping()),
+    readBuffer(nullptr),
+    bIsReference(dataset.isImported())
+{
+    if(bIsReference)
+    {
+        if(row)
+        {
+            dataRefs.reserve(dataset.importData[index].size());
+            for(auto& x : dataset.importData[index])
+            {
+                dataRefs.emplace_back(x);
+            }
+        }
+        else
+        {
+            dataRefs.reserve(dataset.nrow());
+            for(auto& y : dataset.importData)
+            {
+                if(index < y.size())
+                {
+                    dataRefs.emplace_back(y[index]);
+                }
+            }
+        }
+        this->entrySize = dataRefs.size();
+    }
+    else
+    {
+
+        this->streamFile = dataset.getSourceFile();
+        if(row)
+        {
+            this->entrySize = dataset.rowSize(index);
+            this->dataSizes = dataset.getRowIndexSizes(index);
+            this->dataIndex = dataset.getRowIndexPos(index);
+        }
+        else
+        {
+
+            this->column = dataset.getColumnCache(index);
+            this->entrySize = dataset.nrow();
+            this->dataSizes.reserve(dataset.nrow());
+            this->dataIndex.reserve(dataset.nrow());
+
+            for(size_t i = 0; i < dataset.nrow(); ++i)
+            {
+                if(index < dataset.rowSize(i))
+                {
+                    dataSizes.push_back(dataset.size_of(index, i));
+                    dataIndex.push_back(dataset.position(index, i));
+                }
+                else
+                {
+
+                    dataSizes.push_back(0);
+                    dataIndex.push_back(0);
+
+                }
+            }
+        }
+
+        readBuffer = new char[max(dataSizes)*10];
+        readBuffer[max(dataSizes)] = '\0';
+        if(!mapping) openStream(this->streamFile);
+    }
+}
+
+_1Dstream::_1Dstream(const _1Dstream& stream, const vector<unsigned int>& index):
+    stream(nullptr),
+    streamFile(stream.streamFile),
+    mapping(stream.mapping),
+    entrySize(0),
+    bIsReference(stream.bIsReference)
+{
+    if(!bIsReference)
+    {
+        size_t L = index.size();
+        dataIndex.reserve(L);
+        dataSizes.reserve(L);
+
+        for(size_t i = 0; i < L; ++i)
+        {
+            if(index[i] >= stream.size()) continue;
+            dataIndex.push_back(stream.dataIndex[index[i]]);
+            dataSizes.push_back(stream.dataSizes[index[i]]);
+            ++entrySize;
+        }
+
+        readBuffer = new char[max(dataSizes)+1];
+        readBuffer[max(dataSizes)] = '\0';
+        if(!mapping) openStream(streamFile);
+    }
+    else
+    {
+        size_t L = index.size();
+        dataRefs.reserve(L);
+
+        for(size_t i = 0; i < L; ++i)
+        {
+            if(index[i] >= stream.size()) continue;
+            dataRefs.push_back(stream.dataRefs[index[i]]);
+            ++entrySize;
+        }
+    }
+}
+
+_1Dstream::_1Dstream(const _1Dstream& other):
+    stream(nullptr),
+    streamFile(other.streamFile),
+    mapping(other.mapping),
+    entrySize(other.entrySize),
+    dataIndex(other.dataIndex),
+    dataSizes(other.dataSizes),
+    dataRefs(other.dataRefs),
+    column(other.column),
+    readBuffer(new char[max(dataSizes)+1]),
+    bIsReference(other.bIsReference)
+{
+    if(!bIsReference)
+    {
+        readBuffer[max(dataSizes)] = '\0';
+        if(!mapping) openStream(streamFile);
+    }
+}
+_1Dstream::_1Dstream(const string& filename, const vector<uint64_t>& dataIndex, const vector<uint32_t>& dataSizes):
+    stream(nullptr),
+    streamFile(filename),
+    entrySize(dataIndex.size()),
+    dataIndex(dataIndex),
+    dataSizes(dataSizes),
+    readBuffer(new char[max(dataSizes)+1]),
+    bIsReference(false)
+{
+    readBuffer[max(dataSizes)] = '\0';
+    openStream(filename);
+}
+
+_1Dstream& _1Dstream::operator=(const _1Dstream& other)
+{
+    entrySize = other.entrySize;
+    bIsReference = other.bIsReference;
+    dataRefs = other.dataRefs;
+    mapping = other.mapping;
+    column = other.column;
+
+    if(!bIsReference)
+    {
+        streamFile = other.streamFile;
+        dataIndex = other.dataIndex;
+        dataSizes = other.dataSizes;
+
+        delete[] readBuffer;
+        readBuffer = new char[max(dataSizes)+1];
+        readBuffer[max(dataSizes)] = '\0';
+        memcpy(readBuffer, other.readBuffer, max(dataSizes));
+
+        if(!mapping) openStream(streamFile);
+    }
+    return *this;
+}
+
+
+void _1Dstream::openStream(const string& streamFile)
+{
+    if(stream != nullptr)
+    {
+        reset();
+    }
+
+    if(access(streamFile.c_str(), F_OK | W_OK))
+    {
+        cout << ">> ERROR: could not open stream to " << streamFile << '\n';
+        return;
+    }
+
+    this->streamFile = streamFile;
+    stream = fopen(streamFile.c_str(), "rwb");
+}
+
+const char* _1Dstream::get(const unsigned int& i) const
+{
+    return read_cell(mapping.get(), stream, dataIndex[i], dataSizes[i]);
+}
+
+void _1Dstream::view(vector<string_view>& output) const
+{
+    if(bIsReference)
+    {
+        output.reserve(output.size() + entrySize);
+        for(auto& s : dataRefs)
+        {
+            output.emplace_back(s.get());
+        }
+    }
+    else if(mapping)
+    {
+        output.reserve(output.size() + entrySize);
+        for(size_t i = 0; i < entrySize; ++i)
+        {
+            output.emplace_back(mapping->at(dataIndex[i]), dataSizes[i]);
+        }
+    }
+    else
+    {
+        stream_view_batch batch;
+        for(size_t i = 0; i < entrySize; ++i)
+        {
+            batch.add(dataIndex[i], dataSizes[i]);
+        }
+        batch.fill(stream, output);
+    }
+}
+
+string _1Dstream::getString(const unsigned int& i) const
+{
+    if(mapping)
+    {
+        string s(mapping->at(dataIndex[i]), dataSizes[i]);
+        processString(s);
+        return(s);
+    }
+    else if(!bIsReference)
+    {
+        string s(get(i));
+        processString(s);
+        return(s);
+    }
+    else
+    {
+        string s = dataRefs[i];
+        processString(s);
+        return(s);
+    }
+}
+
+float _1Dstream::getFloat(const unsigned int& i) const
+{
+    if(column)
+    {
+        return (*column)[i];
+    }
+    else if(!bIsReference)
+    {
+        const char* c = mapping ? mapping->at(dataIndex[i]) : get(i);
+        float output;
+        return parse_float(c, c + dataSizes[i], output) ? output : NAN;
+    }
+    else
+    {
+        float output;
+        return parse_float(dataRefs[i].get(), output) ? output : NAN;
+    }
+}
+
+void _1Dstream::import(StringVector& storage) const
+{
+    storage.reserve(storage.size() + entrySize);
+    for(size_t i = 0; i < entrySize; ++i)
+    {
+        storage.push_back(getString(i));
+    }
+}
+
+string _1Dstream::operator[](const unsigned int& i) const
+{
+    return getString(i);
+}
+
+float _1Dstream::operator()(const unsigned int& i) const
+{
+    if(column)
+    {
+        return (*column)[i];
+    }
+    else if(!bIsReference)
+    {
+        const char* c = mapping ? mapping->at(dataIndex[i]) : get(i);
+        float output;
+        return parse_float(c, c + dataSizes[i], output) ? output : NAN;
+    }
+    else
+    {
+        float output;
+        return parse_float(dataRefs[i].get(), output) ? output : NAN;
+    }
+}
+
+_1Dstream _1Dstream::substream(const vector<unsigned int>& index)
+{
+    return _1Dstream(*this, index);
+}
+
+_1Dstream& _1Dstream::reduce(const vector<unsigned int>& index)
+{
+    column.reset(); // No longer aligned with the cached column
+
+    if(!bIsReference)
+    {
+        unsigned int cIndex = 0;
+        for(size_t i = 0; i < entrySize; ++cIndex)
+        {
+            if(!anyEqual(cIndex, index))
+            {
+                dataIndex.erase(dataIndex.begin() + i);
+                dataSizes.erase(dataSizes.begin() + i);
+                --entrySize;
+            }
+            else ++i;
+        }
+    }
+    else
+    {
+        unsigned int cIndex = 0;
+        for(size_t i = 0; i < entrySize; ++cIndex)
+        {
+            if(!anyEqual(cIndex, index))
+            {
+                dataRefs.erase(dataRefs.begin() + i);
+                --entrySize;
+            }
+            else ++i;
+        }
+    }
+    return *this;
+}
+
+_1Dstream _1Dstream::operator[](const vector<unsigned int>& index)
+{
+    return substream(index);
+}
+
+bool _1Dstream::check(const string& target) const
+{
+    if(!bIsReference)
+    {
+        for(size_t i = 0; i < entrySize; ++i)
+        {
+            if(cmpString(getString(i), target)) return true;
+        }
+    }
+    else
+    {
+        for(auto& data : dataRefs)
+        {
+            if(cmpString(data, target)) return true;
+        }
+    }
+    return false;
+}
+
+bool _1Dstream::find(uint_v& output, const string& target) const
+{
+    size_t L = output.size();
+    if(!bIsReference)
+    {
+        for(size_t i = 0; i < entrySize; ++i)
+        {
+            if(cmpString(getString(i), target)) output.push_back(i);
+        }
+    }
+    else
+    {
+        unsigned int i = 0;
+        for(auto& data : dataRefs)
+        {
+            if(cmpString(data, target)) output.push_back(i);
+            ++i;
+        }
+    }
+
+    return output.size() > L;
+}
+
+unsigned int _1Dstream::getIndex(const string& target) const
+{
+    uint_v coords;
+    find(coords, target);
+
+    size_t outSIZE = coords.size();
+    if(outSIZE < 1) return UINT_MAX;
+    if(outSIZE < 2) return coords.front();
+    size_t L = target.size();
+
+    unsigned int minSizeDiff = L, outIndex = 0;
+
+    if(outSIZE < 2) return coords.front();
+
+    for(size_t i = 0; i < outSIZE; ++i)
+    {
+        unsigned int othercmp = charMatchNum(target, get(coords[i]));
+        unsigned int sizecmp = othercmp > L ? othercmp - L : L - othercmp;
+        if(sizecmp < minSizeDiff)
+        {
+            minSizeDiff = sizecmp;
+            outIndex = i;
+        }
+    }
+
+    return outIndex;
+}
+
+_2Dstream::_2Dstream():
+    stream(nullptr),
+    streamSize(0),
+    numRows(0),
+    numColumns(0),
+    readBuffer(new char[STREAM_SCAN_BUFFER_SIZE]),
+    delim("\t"),
+    cached_alignment(ORIENTATION_UNKNOWN),
+    verbose(false),
+    active(false),
+    imported(false),
+    bOpen(false),
+    bMapped(false),
+    bSidecar(true),
+    numThreads(0),
+    search_index(nullptr) { }
+
+_2Dstream::_2Dstream(const string& filename,
+                     const bool& verbose,
+                     const string& delim,
+                     const bool& mapped):
+    stream(nullptr),
+    streamSize(0),
+    numRows(0),
+    numColumns(0),
+    readBuffer(new char[STREAM_SCAN_BUFFER_SIZE]),
+    delim(delim),
+    cached_alignment(ORIENTATION_UNKNOWN),
+    verbose(verbose),
+    active(false),
+    imported(false),
+    bOpen(false),
+    bMapped(mapped),
+    bSidecar(true),
+    numThreads(0),
+    search_index(nullptr)
+{
+    openStream(filename, true, delim, mapped);
+}
+
+_2Dstream::_2Dstream(const _2Dstream& other):
+    stream(nullptr),
+    streamFile(other.streamFile),
+    streamSize(other.streamSize),
+    numRows(other.numRows),
+    numColumns(other.numColumns),
+    readBuffer(new char[STREAM_SCAN_BUFFER_SIZE]),
+    mapping(other.mapping),
+    delim(other.delim),
+    rowSizes(other.rowSizes),
+    rowDataSizes(other.rowDataSizes),
+    cellIndex(other.cellIndex),
+    importData(other.importData),
+    columnCache(other.columnCache),
+    verbose(other.verbose),
+    active(other.active),
+    bOpen(other.bOpen),
+    bMapped(other.bMapped),
+    bSidecar(other.bSidecar),
+    numThreads(other.numThreads),
+    imported(other.imported)
+{
+
+    search_index = other.search_index;
+    ngram_index = other.ngram_index;
+
+    if(other.isOpen())
+    {
+        stream = fopen(other.streamFile.c_str(), "rb");
+    }
+    else
+    {
+        stream = nullptr;
+    }
+
+}
+
+_2Dstream::_2Dstream(const string& filename, const stream_index& cellIndex,
+                     const dimArray& rowSizes, const dimArray& rowDataSizes,
+                     const string& delim):
+    stream(nullptr),
+    streamFile(filename),
+    numRows(rowSizes.size()),
+    numColumns(rowSizes.empty() ? 0 : max(rowSizes)),
+    readBuffer(new char[STREAM_SCAN_BUFFER_SIZE]),
+    delim(delim),
+    cached_alignment(ORIENTATION_UNKNOWN),
+    rowSizes(rowSizes),
+    rowDataSizes(rowDataSizes),
+    cellIndex(cellIndex),
+    verbose(false),
+    active(false),
+    imported(false),
+    bOpen(false),
+    bMapped(false),
+    bSidecar(true),
+    numThreads(0),
+    search_index(nullptr)
+{
+    openStream(filename, false, delim);
+    columnCache.assign(numColumns, nullptr);
+}
+
+_2Dstream& _2Dstream::operator=(const _2Dstream& other)
+{
+    streamFile = other.streamFile;
+    readBuffer = new char[STREAM_SCAN_BUFFER_SIZE];
+    streamSize = other.streamSize;
+    numRows = other.numRows;
+    numColumns = other.numColumns;
+    rowSizes = other.rowSizes;
+    rowDataSizes = other.rowDataSizes;
+    cellIndex = other.cellIndex;
+    importData = other.importData;
+    columnCache = other.columnCache;
+    verbose = other.verbose;
+    active = other.active;
+    bOpen = other.isOpen();
+    imported = other.imported;
+    delim = other.delim;
+    numThreads = other.numThreads;
+    bSidecar = other.bSidecar;
+
+    search_index = other.search_index;
+    ngram_index = other.ngram_index;
+
+    openStream(streamFile, false, delim);
+
+    mapping = other.mapping;
+    bMapped = other.bMapped;
+
+    return *this;
+}
+
+uint64_t stream_hash_index::hash(const string_view& s)
+{
+    uint64_t output = 14695981039346656037ULL; // FNV-1a of the lowercase text
+    for(auto& c : s)
+    {
+        output = (output ^ uint8_t(isUpperCase(c) ? c + 32 : c)) * 1099511628211ULL;
+    }
+    return output ? output : 1; // 0 marks an empty slot
+}
+
+void stream_hash_index::build(vector<pair<uint64_t, uint64_t>>& entries)
+{
+
+    sort(entries.begin(), entries.end());
+
+    size_t numKeys = 0;
+    for(size_t i = 0; i < entries.size(); ++i)
+    {
+        if(!i || (entries[i].first != entries[i-1].first)) ++numKeys;
+    }
+
+    size_t capacity = 16;
+    while(capacity < 2*numKeys) capacity <<= 1;
+
+    slots.assign(capacity, slot{0, 0, 0});
+    coords.resize(entries.size());
+
+    for(size_t i = 0, j; i < entries.size(); i = j)
+    {
+        for(j = i; (j < entries.size()) && (entries[j].first == entries[i].first); ++j)
+        {
+            coords[j] = entries[j].second;
+        }
+
+        size_t k = entries[i].first & (capacity - 1);
+        while(slots[k].hash) k = (k + 1) & (capacity - 1);
+        slots[k] = slot{ entries[i].first, i, j - i };
+    }
+
+}
+
+const uint64_t* stream_hash_index::lookup(const uint64_t& hash, size_t& count) const
+{
+    if(slots.empty())
+    {
+        return nullptr;
+    }
+
+    const size_t mask = slots.size() - 1;
+    for(size_t k = hash & mask; slots[k].hash; k = (k + 1) & mask)
+    {
+        if(slots[k].hash == hash)
+        {
+            count = slots[k].count;
+            return coords.data() + slots[k].begin;
+        }
+    }
+
+    return nullptr;
+}
+
+void stream_ngram_index::grams(const string_view& s, vector<uint32_t>& output)
+{
+    output.clear();
+    if(s.size() < 3)
+    {
+        return;
+    }
+
+    auto fold = [](const char& c){ return uint32_t(uint8_t(isUpperCase(c) ? c + 32 : c)); };
+
+    uint32_t key = (fold(s[0]) << 8) | fold(s[1]);
+    for(size_t i = 2; i < s.size(); ++i)
+    {
+        key = ((key << 8) | fold(s[i])) & 0xFFFFFF;
+        output.push_back(key);
+    }
+
+    sort(output.begin(), output.end());
+    output.erase(unique(output.begin(), output.end()), output.end());
+}
+
+void stream_ngram_index::build(vector<uint64_t>& entries, const vector<uint64_t>& rowStarts)
+{
+
+    sort(entries.begin(), entries.end());
+
+    this->rowStarts = rowStarts;
+
+    keys.clear();
+    starts.clear();
+    postings.resize(entries.size());
+
+    for(size_t i = 0; i < entries.size(); ++i)
+    {
+        const uint32_t key = entries[i] >> 32;
+        if(keys.empty() || (keys.back() != key))
+        {
+            keys.push_back(key);
+            starts.push_back(i);
+        }
+        postings[i] = entries[i] & UINT32_MAX;
+    }
+
+    starts.push_back(postings.size());
+
+}
+
+void stream_ngram_index::candidates(const vector<uint32_t>& grams, const size_t& minShared,
+                                    vector<uint32_t>& output) const
+{
+
+    vector<pair<const uint32_t*, const uint32_t*>> lists;
+
+    for(auto& gram : grams)
+    {
+        auto it = lower_bound(keys.begin(), keys.end(), gram);
+        if((it != keys.end()) && (*it == gram))
+        {
+            const size_t k = it - keys.begin();
+            lists.emplace_back(postings.data() + starts[k], postings.data() + starts[k+1]);
+        }
+        else if(minShared >= grams.size())
+        {
+            return; // A required trigram occurs nowhere
+        }
+    }
+
+    if(lists.empty() || (lists.size() < minShared))
+    {
+        return;
+    }
+
+    if(minShared >= grams.size())
+    {
+
+        // Intersect, starting from the shortest list
+
+        sort(lists.begin(), lists.end(), [](const pair<const uint32_t*, const uint32_t*>& a,
+                                            const pair<const uint32_t*, const uint32_t*>& b)
+        {
+            return a.second - a.first < b.second - b.first;
+        });
+
+        for(const uint32_t* c = lists.front().first; c < lists.front().second; ++c)
+        {
+            size_t k = 1;
+            for(; k < lists.size(); ++k)
+            {
+                lists[k].first = lower_bound(lists[k].first, lists[k].second, *c);
+                if((lists[k].first == lists[k].second) || (*lists[k].first != *c)) break;
+            }
+            if(k == lists.size()) output.push_back(*c);
+        }
+
+    }
+    else
+    {
+
+        // Count the lists each cell appears in
+
+        vector<uint32_t> cells;
+        for(auto& list : lists)
+        {
+            cells.insert(cells.end(), list.first, list.second);
+        }
+        sort(cells.begin(), cells.end());
+
+        for(size_t i = 0, j; i < cells.size(); i = j)
+        {
+            for(j = i + 1; (j < cells.size()) && (cells[j] == cells[i]); ++j);
+            if(j - i >= minShared) output.push_back(cells[i]);
+        }
+
+    }
+
+}
+
+Vector2u stream_ngram_index::coords(const uint32_t& cell) const
+{
+    const size_t y = upper_bound(rowStarts.begin(), rowStarts.end(), uint64_t(cell)) - rowStarts.begin() - 1;
+    return Vector2u(cell - rowStarts[y], y);
+}
+
+void _2Dstream::indexNgrams()
+{
+
+    if(verbose) cout << "Indexing n-grams...";
+
+    vector<uint64_t> entries;
+    vector<uint64_t> rowStarts(nrow() + 1, 0);
+    vector<string_view> cells;
+    vector<uint32_t> cellGrams;
+
+    uint64_t cell = 0;
+    for(size_t y = 0; y < nrow(); ++y)
+    {
+        rowStarts[y] = cell;
+
+        cells.clear();
+        viewRow(cells, y);
+
+        for(size_t x = 0; x < cells.size(); ++x)
+        {
+            stream_ngram_index::grams(cells[x], cellGrams);
+            for(auto& gram : cellGrams)
+            {
+                entries.push_back((uint64_t(gram) << 32) | (cell + x));
+            }
+        }
+
+        cell += cells.size();
+    }
+    rowStarts[nrow()] = cell;
+
+    if(cell > UINT32_MAX)
+    {
+        if(verbose) cout << " failed (too many cells)\n";
+        return;
+    }
+
+    shared_ptr<stream_ngram_index> newIndex = make_shared<stream_ngram_index>();
+    newIndex->build(entries, rowStarts);
+    ngram_index = newIndex;
+
+    if(verbose) cout << " success\n";
+
+}
+
+bool _2Dstream::lookup_ngrams(const string& target, const size_t& maxMissing, vector<uint32_t>& output) const
+{
+    vector<uint32_t> grams;
+    stream_ngram_index::grams(target, grams);
+
+    // Each missing character removes at most three of the query's trigrams
+
+    if(grams.size() <= 3*maxMissing)
+    {
+        return false;
+    }
+
+    ngram_index->candidates(grams, grams.size() - 3*maxMissing, output);
+    return true;
+}
+
+// Fuzzy scan of a single cell, as performed along the stream by find(): target
+// characters are matched in order, case-insensitively, passing over unmatched
+// letters, and any other character (or the cell end) closes the attempt
+
+bool fuzzy_cell_match(const string_view& cell, const string& target,
+                      const unsigned int& initCoord, const unsigned int& matchFactor)
+{
+    unsigned int matchCoord = initCoord;
+    char c;
+
+    for(size_t i = 0; i <= cell.size(); ++i)
+    {
+        c = i < cell.size() ? cell[i] : '\0';
+
+        if((matchCoord < target.size()) && ((c == target[matchCoord]) || case_cmp(c, target[matchCoord])))
+        {
+            ++matchCoord;
+        }
+        else if(isLowerCase(c) || isUpperCase(c))
+        {
+            continue;
+        }
+        else if(matchCoord >= matchFactor)
+        {
+            return true;
+        }
+        else
+        {
+            matchCoord = initCoord;
+        }
+    }
+
+    return false;
+}
+
+// Case-insensitive search of the candidate cells for each occurrence of target
+
+void ngram_exact_matches(const _2Dstream& stream, const stream_ngram_index& index,
+                         const vector<uint32_t>& candidates, const string& target,
+                         const unsigned long long& maxCellSize, const bool& bFirst, VectorPairU& output)
+{
+    const size_t L = target.size();
+
+    for(auto& cell : candidates)
+    {
+        Vector2u coords = index.coords(cell);
+        if(stream.size_of(coords.x, coords.y) > maxCellSize) continue;
+
+        const string_view text = stream.view(coords.x, coords.y);
+        for(size_t i = 0, j; i + L <= text.size(); )
+        {
+            for(j = 0; (j < L) && ((text[i+j] == target[j]) || case_cmp(text[i+j], target[j])); ++j);
+            if(j == L)
+            {
+                output.emplace_back(coords);
+                if(bFirst) return;
+                i += L;
+            }
+            else ++i;
+        }
+    }
+}
+
+void _2Dstream::index(const int& max_levels)
+{
+
+    if(search_index)
+    {
+        cout << "Stream is already indexed\n";
+        return;
+    }
+
+    if(stream || imported)
+    {
+        if(verbose) cout << "Indexing...";
+
+        vector<pair<uint64_t, uint64_t>> entries;
+        vector<string_view> cells;
+
+        for(size_t y = 0; y < nrow(); ++y)
+        {
+            cells.clear();
+            viewRow(cells, y);
+
+            for(size_t x = 0; x < cells.size(); ++x)
+            {
+                if(!cells[x].empty())
+                {
+                    entries.emplace_back(stream_hash_index::hash(cells[x]), (uint64_t(y) << 32) | x);
+                }
+            }
+        }
+
+        if(!entries.empty())
+        {
+            shared_ptr<stream_hash_index> newIndex = make_shared<stream_hash_index>();
+            newIndex->build(entries);
+            search_index = newIndex;
+
+            if(verbose) cout << " success\n";
+        }
+        else
+        {
+            if(verbose) cout << " failed\n";
+        }
+
+    }
+
+}
+
+bool _2Dstream::lookup_index(const string& target, VectorPairU* output) const
+{
+
+    size_t count = 0;
+    const uint64_t* coords = search_index->lookup(stream_hash_index::hash(target), count);
+    bool bFound = false;
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        const unsigned int x = coords[i] & UINT32_MAX, y = coords[i] >> 32;
+        const string_view cell = view(x, y);
+
+        // Verify against the cell text to rule out hash collisions
+
+        if(cell.size() != target.size()) continue;
+
+        size_t j = 0;
+        while((j < cell.size()) && ((cell[j] == target[j]) || case_cmp(cell[j], target[j]))) ++j;
+        if(j < cell.size()) continue;
+
+        bFound = true;
+        if(!output) break;
+        output->emplace_back(x, y);
+    }
+
+    return bFound;
+
+}
+
+void _2Dstream::reset()
+{
+    fclose(stream);
+    numRows = 0;
+    numColumns = 0;
+    streamSize = 0;
+    streamFile.clear();
+    rowDataSizes.clear();
+    rowSizes.clear();
+    cellIndex.clear();
+    columnCache.clear();
+    cached_alignment = ORIENTATION_UNKNOWN;
+    importData.clear();
+    imported = false;
+    bOpen = false;
+    mapping.reset();
+
+    search_index.reset();
+    ngram_index.reset();
+
+}
+
+void _2Dstream::reload()
+{
+    const string filename = getSourceFile(); // Cleared on reset
+    openStream(filename, true, "", bMapped);
+}
+
+bool _2Dstream::map()
+{
+    if(streamFile.empty())
+    {
+        return false;
+    }
+
+    mapping = make_shared<stream_map>(streamFile);
+
+    if(!mapping->valid() || (mapping->size() < streamSize))
+    {
+        if(verbose) cout << ">> Memory map unavailable for " << streamFile << ", using buffered reads\n";
+        mapping.reset();
+        bMapped = false;
+        return false;
+    }
+
+    bMapped = true;
+    return true;
+}
+
+void _2Dstream::unmap()
+{
+    mapping.reset();
+    bMapped = false;
+}
+
+bool _2Dstream::openStream(const string& filename, const bool& update,
+                           const string& delim, const bool& mapped)
+{
+
+    if(stream)
+    {
+        reset();
+    }
+
+    if(access(filename.c_str(), F_OK))
+    {
+        if(verbose) cout << ">> ERROR: could not access file at " << filename << "\n";
+        return false;
+    }
+
+    if(verbose) cout << ">> Opening data stream from " << filename << '\n';
+
+    stream = fopen(filename.c_str(), "rb");
+
+    if(!stream)
+    {
+        cout << "Error opening stream to " << filename << '\n';
+        return false;
+    }
+
+    fseek(stream, 0, SEEK_END);
+    streamSize = ftell(stream);
+    fseek(stream, 0, SEEK_SET);
+
+    streamFile = filename;
+
+    if(mapped)
+    {
+        map();
+    }
+
+    // Restore a cached index if the source is unchanged since it was written
+
+    if(update && bSidecar && loadIndex("", delim))
+    {
+        if(verbose) cout << ">> Loaded cell index from " << streamFile << STREAM_INDEX_SIDECAR_EXT << '\n';
+        bOpen = true;
+        return true;
+    }
+
+    // Determine the appropriate delimiter
+
+    if(delim.empty())
+    {
+        if(filename.find(".csv") < filename.size())
+        {
+            if(getCharCount(";") > getCharCount(","))
+            {
+                this->delim = ";";
+            }
+            else
+            {
+                this->delim = ",";
+            }
+        }
+        else if(filename.find(".tsv") < filename.size())
+        {
+            this->delim = "\t";
+        }
+        else
+        {
+            std::map<string, size_t> delim_counts;
+            delim_counts["\t"] = getCharCount("\t");
+            delim_counts[","] = getCharCount(",");
+            delim_counts[";"] = getCharCount(";");
+
+            size_t maxCount = 0,
+                   maxCountIndex = 0;
+
+            int i = 0;
+
+            for(auto& pair : delim_counts)
+            {
+                if(pair.second > maxCount)
+                {
+                    maxCount = pair.second;
+                    maxCountIndex = i;
+                }
+
+                ++i;
+            }
+
+            i = 0;
+            for(auto& pair : delim_counts)
+            {
+                if(i == maxCountIndex)
+                {
+                    this->delim = pair.first;
+                    break;
+                }
+                ++i;
+            }
+        }
+    }
+    else
+    {
+        this->delim = delim;
+    }
+
+    if(update)
+    {
+        this->update();
+        if(bSidecar && (streamSize >= STREAM_INDEX_SIDECAR_MIN_SIZE))
+        {
+            saveIndex();
+        }
+    }
+
+    if(verbose) cout << "\r>> Finished\t\t\t\n";
+
+    bOpen = true;
+
+    return true;
+}
+
+void stream_index::push_row(const uint64_t* positions, const uint64_t* sizes, const size_t& count)
+{
+
+    uint64_t base = count ? positions[0] : 0, maxValue = 0;
+    for(size_t i = 1; i < count; ++i)
+    {
+        if(positions[i] < base) base = positions[i];
+    }
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        if(positions[i] - base > maxValue) maxValue = positions[i] - base;
+        if(sizes[i] > maxValue) maxValue = sizes[i];
+    }
+
+    uint8_t width = maxValue <= UINT8_MAX ? 1 :
+                    maxValue <= UINT16_MAX ? 2 :
+                    maxValue <= UINT32_MAX ? 4 : 8;
+
+    rowOffsets.push_back(base);
+    rowPointers.push_back(cellData.size());
+    rowWidths.push_back(width);
+
+    size_t pos = cellData.size();
+    cellData.resize(pos + 2*count*width);
+
+    uint64_t value;
+    for(size_t i = 0; i < count; ++i)
+    {
+        // Little-endian truncation to the row width
+
+        value = positions[i] - base;
+        memcpy(cellData.data() + pos, &value, width);
+        pos += width;
+
+        value = sizes[i];
+        memcpy(cellData.data() + pos, &value, width);
+        pos += width;
+    }
+
+}
+
+void stream_index::push_row(const stream_index& other, const size_t& y, const size_t& count)
+{
+    const uint8_t* c = other.cellData.data() + other.rowPointers[y];
+
+    rowOffsets.push_back(other.rowOffsets[y]);
+    rowPointers.push_back(cellData.size());
+    rowWidths.push_back(other.rowWidths[y]);
+    cellData.insert(cellData.end(), c, c + 2*count*other.rowWidths[y]);
+}
+
+void stream_index::append(const stream_index& other)
+{
+    const uint64_t base = cellData.size();
+
+    rowOffsets.insert(rowOffsets.end(), other.rowOffsets.begin(), other.rowOffsets.end());
+    rowWidths.insert(rowWidths.end(), other.rowWidths.begin(), other.rowWidths.end());
+    cellData.insert(cellData.end(), other.cellData.begin(), other.cellData.end());
+
+    rowPointers.reserve(rowPointers.size() + other.rowPointers.size());
+    for(auto& pointer : other.rowPointers)
+    {
+        rowPointers.push_back(base + pointer);
+    }
+}
+
+void stream_index::reserve(const size_t& rows, const size_t& bytes)
+{
+    rowOffsets.reserve(rows);
+    rowPointers.reserve(rows);
+    rowWidths.reserve(rows);
+    cellData.reserve(bytes);
+}
+
+void stream_index::truncate(const size_t& rows)
+{
+    if(rows >= size())
+    {
+        return;
+    }
+
+    cellData.resize(rowPointers[rows]);
+    rowOffsets.resize(rows);
+    rowPointers.resize(rows);
+    rowWidths.resize(rows);
+}
+
+void stream_index::clear()
+{
+    rowOffsets.clear();
+    rowPointers.clear();
+    rowWidths.clear();
+    cellData.clear();
+}
+
+/*
+    Incremental cell indexer for a contiguous range of rows in a stream.  The
+    state is carried across buffer refills, so a range may be fed in any
+    number of pieces, and independent ranges may be indexed in parallel.
+*/
+
+#define STREAM_SKIP_NONE        0
+#define STREAM_SKIP_DELIM_CR    1   // Carriage return trailing a delimiter
+#define STREAM_SKIP_NEWLINE     2   // '\r' or '\n' trailing a line break
+#define STREAM_SKIP_NEWLINE_LF  3   // '\n' trailing a "\n\r" sequence
+
+struct stream_index_block
+{
+    stream_index        index;
+    dimArray            rowSizes;
+    dimArray            rowDataSizes;
+
+    unsigned long long  lastIndexPos;
+    unsigned long long  lastRowIndex;
+    unsigned long long  next;           // Position following the last structural character processed
+    uint8_t             skip;
+    bool                bQuote;
+    bool                bRowOpen;
+
+    vector<uint64_t>    cellPositions;  // Cells of the open row
+    vector<uint64_t>    cellSizes;
+
+    char_scanner            scanner;
+    vector<char_scan_mask>  masks;
+
+    stream_index_block(const unsigned long long& begin,
+                       const string& delim):
+        lastIndexPos(begin),
+        lastRowIndex(begin),
+        next(begin),
+        skip(begin ? STREAM_SKIP_NEWLINE : STREAM_SKIP_NONE),
+        bQuote(false),
+        bRowOpen(false),
+        scanner(delim) { }
+
+    inline void open_row()
+    {
+        rowSizes.push_back(0);
+        rowDataSizes.push_back(0);
+        cellPositions.clear();
+        cellSizes.clear();
+        bRowOpen = true;
+    }
+
+    inline void close_row(const unsigned long long& i)
+    {
+        index.push_row(cellPositions.data(), cellSizes.data(), cellPositions.size());
+        rowDataSizes.back() = i - lastRowIndex;
+        bRowOpen = false;
+    }
+
+    inline void push_cell(const unsigned long long& i)
+    {
+        cellPositions.push_back(lastIndexPos);
+        cellSizes.push_back(i - lastIndexPos);
+        ++rowSizes.back();
+    }
+
+    // Process a structural character (quote, line break or delimiter) at position i
+
+    inline void process(const char& c, const unsigned long long& i)
+    {
+
+        if(i != next) // Ordinary characters were passed over since the last structural character
+        {
+            skip = STREAM_SKIP_NONE;
+            if(!bRowOpen) open_row();
+        }
+
+        next = i + 1;
+
+        if(skip)
+        {
+            if((skip == STREAM_SKIP_DELIM_CR) && (c == '\r'))
+            {
+                skip = STREAM_SKIP_NONE;
+                lastIndexPos = i + 1;
+                return;
+            }
+            else if(((skip == STREAM_SKIP_NEWLINE) && ((c == '\r') || (c == '\n'))) ||
+                    ((skip == STREAM_SKIP_NEWLINE_LF) && (c == '\n')))
+            {
+                skip = (skip == STREAM_SKIP_NEWLINE) && (c == '\r') ?
+                            STREAM_SKIP_NEWLINE_LF : STREAM_SKIP_NONE;
+                lastIndexPos = i + 1;
+                lastRowIndex = i + 1;
+                return;
+            }
+
+            skip = STREAM_SKIP_NONE;
+        }
+
+        if(!bRowOpen) open_row();
+
+        if(c == '\"')
+        {
+            bQuote = !bQuote;
+        }
+        else if(!bQuote)
+        {
+            if((c == '\n') || (c == '\r'))
+            {
+                push_cell(i);
+                close_row(i);
+
+                lastIndexPos = i + 1;
+                lastRowIndex = i + 1;
+                skip = STREAM_SKIP_NEWLINE;
+            }
+            else
+            {
+                push_cell(i);
+
+                lastIndexPos = i + 1;
+                skip = STREAM_SKIP_DELIM_CR;
+            }
+        }
+    }
+
+    void scan(const char* c, const size_t& L, const unsigned long long& offset)
+    {
+        scanner.scan(c, L, masks);
+
+        uint64_t bits;
+        unsigned int bit;
+        size_t j;
+
+        for(size_t b = 0; b < masks.size(); ++b)
+        {
+            bits = masks[b].any();
+            while(bits)
+            {
+                bit = lowest_bit(bits);
+                bits &= bits - 1;
+
+                if(bQuote && !(masks[b].quote & (uint64_t(1) << bit)))
+                {
+                    continue; // Only a closing quote is significant within a quoted field
+                }
+
+                j = b*CHAR_SCAN_BLOCK_SIZE + bit;
+                process(c[j], offset + j);
+            }
+        }
+    }
+
+    void finish(const unsigned long long& end)
+    {
+        if((end > next) && !bRowOpen)
+        {
+            open_row();
+        }
+
+        if(bRowOpen)
+        {
+            if(end > lastIndexPos)
+            {
+                push_cell(end);
+            }
+            close_row(end);
+        }
+    }
+};
+
+// Feed the bytes of [begin, end) to a reader, from the memory map if available.
+// Reading stops early if the reader returns false.
+
+template<typename reader_t>
+void read_stream_range(const char* mapData,
+                       const string& filename,
+                       const unsigned long long& begin,
+                       const unsigned long long& end,
+                       reader_t reader,
+                       const size_t& bufferSize = STREAM_SCAN_BUFFER_SIZE)
+{
+    if(begin >= end)
+    {
+        return;
+    }
+
+    if(mapData)
+    {
+        reader(mapData + begin, end - begin, begin);
+        return;
+    }
+
+    FILE* file = fopen(filename.c_str(), "rb");
+    if(!file)
+    {
+        return;
+    }
+
+    vector<char> buffer(bufferSize);
+    fseeko(file, begin, SEEK_SET);
+
+    for(unsigned long long pos = begin, L; pos < end; pos += L)
+    {
+        L = end - pos < bufferSize ? end - pos : bufferSize;
+        L = fread(buffer.data(), 1, L, file);
+        if(!L || !reader(buffer.data(), L, pos)) break;
+    }
+
+    fclose(file);
+}
+
+void _2Dstream::update()
+{
+
+    if(imported)
+    {
+        numRows = importData.size();
+        numColumns = maxSize(importData);
+        if(verbose) cout << ">> Updating imported stream... ";
+        for(size_t i = 0; i < numColumns; ++i)
+        {
+            if(i >= rowSizes.size()) rowSizes.push_back(importData[i].size());
+            else rowSizes[i] = importData[i].size();
+        }
+        columnCache.assign(numColumns, nullptr);
+        if(verbose) cout << "done\n";
+        return;
+    }
+
+    if(nrow() > 0)
+    {
+        cellIndex.clear();
+        rowSizes.clear();
+        rowDataSizes.clear();
+    }
+
+    numRows = 0;
+
+    if(!streamSize)
+    {
+        cout << "Warning: loaded stream is empty\n";
+        return;
+    }
+
+    const unsigned long long blockSize = STREAM_SCAN_BUFFER_SIZE;
+    unsigned int numChunks = 1;
+
+    if(streamSize >= STREAM_PARALLEL_INDEX_MIN_SIZE)
+    {
+        numChunks = numThreads ? numThreads : thread::hardware_concurrency();
+        if(!numChunks) numChunks = 1;
+        if(streamSize/numChunks < blockSize) numChunks = streamSize/blockSize + 1;
+    }
+
+    atomic<unsigned long long> progress(0ULL);
+    thread* readout;
+
+    if(verbose)
+    {
+        readout = new thread([&]()
+        {
+            cout << ">> Updating: 0%";
+            while(progress < streamSize)
+            {
+                cout << "\r>> Updating: " << progress << "b / " <<
+                     streamSize << "b (" << (unsigned int)(float(progress)/streamSize*100) << "%)";
+                this_thread::sleep_for(chrono::duration<float>(DATA_READOUT_REFRESH));
+            }
+        });
+    }
+
+    const char* mapData = mapping ? mapping->data() : nullptr;
+    vector<stream_index_block> blocks;
+
+    if(numChunks < 2)
+    {
+        blocks.emplace_back(0ULL, delim);
+        read_stream_range(mapData, streamFile, 0ULL, streamSize,
+                          [&](const char* c, const size_t& L, const unsigned long long& offset)
+        {
+            blocks.back().scan(c, L, offset);
+            progress += L;
+            return true;
+        });
+        blocks.back().finish(streamSize);
+    }
+    else
+    {
+
+        // Quote parity of each nominal chunk determines whether its first byte lies within a quoted field
+
+        vector<unsigned long long> bounds(numChunks + 1);
+        vector<size_t> quoteCounts(numChunks, 0);
+        vector<thread> workers;
+
+        for(size_t k = 0; k <= numChunks; ++k)
+        {
+            bounds[k] = streamSize*k/numChunks;
+        }
+
+        for(size_t k = 0; k < numChunks; ++k)
+        {
+            workers.emplace_back([&, k]()
+            {
+                read_stream_range(mapData, streamFile, bounds[k], bounds[k+1],
+                                  [&](const char* c, const size_t& L, const unsigned long long& offset)
+                {
+                    quoteCounts[k] += count_chars(c, L, "\"");
+                    return true;
+                });
+            });
+        }
+
+        for(auto& worker : workers)
+        {
+            worker.join();
+        }
+        workers.clear();
+
+        // Move each boundary forward to the next unambiguous line break, so that
+        // every chunk begins on a fresh row and can be indexed independently
+
+        vector<unsigned long long> rowBounds(1, 0ULL);
+        bool bQuote = false;
+
+        for(size_t k = 1; k < numChunks; ++k)
+        {
+            if(quoteCounts[k-1] % 2) bQuote = !bQuote;
+
+            bool bChunkQuote = bQuote;
+            unsigned long long lineBreak = ULLONG_MAX;
+            char prev = '\0';
+
+            if(bounds[k] > 0)
+            {
+                read_stream_range(mapData, streamFile, bounds[k] - 1, bounds[k],
+                                  [&](const char* c, const size_t& L, const unsigned long long& offset)
+                {
+                    prev = *c;
+                    return true;
+                });
+            }
+
+            read_stream_range(mapData, streamFile, bounds[k], bounds[k+1],
+                              [&](const char* c, const size_t& L, const unsigned long long& offset)
+            {
+                for(size_t j = 0; (j < L) && (lineBreak == ULLONG_MAX); ++j)
+                {
+                    if(c[j] == '\"')
+                    {
+                        bChunkQuote = !bChunkQuote;
+                    }
+                    else if(!bChunkQuote && ((c[j] == '\n') || (c[j] == '\r')) &&
+                            (prev != '\n') && (prev != '\r') && !isCharType(prev, delim))
+                    {
+                        lineBreak = offset + j;
+                    }
+                    prev = c[j];
+                }
+                return lineBreak == ULLONG_MAX;
+            }, STREAM_SEARCH_BUFFER_SIZE);
+
+            if((lineBreak != ULLONG_MAX) && (lineBreak + 1 < streamSize))
+            {
+                rowBounds.push_back(lineBreak + 1);
+            }
+        }
+
+        rowBounds.push_back(streamSize);
+
+        // Index the chunks in parallel
+
+        blocks.reserve(rowBounds.size() - 1);
+        for(size_t k = 0; k < rowBounds.size() - 1; ++k)
+        {
+            blocks.emplace_back(rowBounds[k], delim);
+        }
+
+        for(size_t k = 0; k < blocks.size(); ++k)
+        {
+            workers.emplace_back([&, k]()
+            {
+                read_stream_range(mapData, streamFile, rowBounds[k], rowBounds[k+1],
+                                  [&](const char* c, const size_t& L, const unsigned long long& offset)
+                {
+                    blocks[k].scan(c, L, offset);
+                    progress += L;
+                    return true;
+                });
+                blocks[k].finish(rowBounds[k+1]);
+            });
+        }
+
+        for(auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    // Merge the per-chunk row tables
+
+    size_t totalRows = 0, totalBytes = 0;
+    for(auto& block : blocks)
+    {
+        totalRows += block.rowSizes.size();
+        totalBytes += block.index.cellData.size();
+    }
+
+    cellIndex.reserve(totalRows, totalBytes);
+    rowSizes.reserve(totalRows);
+    rowDataSizes.reserve(totalRows);
+
+    for(auto& block : blocks)
+    {
+        cellIndex.append(block.index);
+        block.index.clear();
+        rowSizes.insert(rowSizes.end(), block.rowSizes.begin(), block.rowSizes.end());
+        rowDataSizes.insert(rowDataSizes.end(), block.rowDataSizes.begin(), block.rowDataSizes.end());
+    }
+
+    numRows = rowSizes.size();
+    numColumns = rowSizes.empty() ? 0 : max(rowSizes);
+    columnCache.assign(numColumns, nullptr);
+    progress = streamSize;
+
+    if(verbose)
+    {
+        if(readout->joinable()) readout->join();
+        delete(readout);
+        cout << "\r>> Updating: " << streamSize << "b / " <<
+             streamSize << "b (100%)\n";
+    }
+}
+
+size_t _2Dstream::complete_rows() const
+{
+    if(!numRows)
+    {
+        return 0;
+    }
+
+    // Only a row closed at the end of the source rather than by a line break ends there
+
+    const size_t last = numRows - 1;
+    return cellIndex.row_offset(last) + rowDataSizes[last] < streamSize ? numRows : last;
+}
+
+size_t _2Dstream::refresh()
+{
+
+    if(imported || !stream)
+    {
+        return 0;
+    }
+
+    fseek(stream, 0, SEEK_END);
+    const unsigned long long newSize = ftell(stream);
+    fseek(stream, 0, SEEK_SET);
+
+    if(newSize == streamSize)
+    {
+        return 0;
+    }
+
+    if(newSize < streamSize)
+    {
+        if(verbose) cout << ">> " << streamFile << " was truncated, indexing again\n";
+        const string filename = streamFile;
+        openStream(filename, true, delim, bMapped);
+        return complete_rows();
+    }
+
+    // The indexer state just after a line break is that of a fresh block, so
+    // indexing resumes after the last complete row with nothing carried over
+
+    const size_t completeRows = complete_rows();
+    const unsigned long long resume = completeRows ?
+            cellIndex.row_offset(completeRows - 1) + rowDataSizes[completeRows - 1] + 1 : 0ULL;
+
+    streamSize = newSize;
+    if(bMapped) map();
+
+    const char* mapData = mapping ? mapping->data() : nullptr;
+
+    stream_index_block block(resume, delim);
+    read_stream_range(mapData, streamFile, resume, streamSize,
+                      [&](const char* c, const size_t& L, const unsigned long long& offset)
+    {
+        block.scan(c, L, offset);
+        return true;
+    });
+    block.finish(streamSize);
+
+    // Replace the unterminated final row, if any, and extend the row tables
+
+    cellIndex.truncate(completeRows);
+    rowSizes.resize(completeRows);
+    rowDataSizes.resize(completeRows);
+
+    cellIndex.append(block.index);
+    rowSizes.insert(rowSizes.end(), block.rowSizes.begin(), block.rowSizes.end());
+    rowDataSizes.insert(rowDataSizes.end(), block.rowDataSizes.begin(), block.rowDataSizes.end());
+
+    numRows = rowSizes.size();
+    for(auto& size : block.rowSizes)
+    {
+        if(size > numColumns) numColumns = size;
+    }
+
+    columnCache.assign(numColumns, nullptr);
+    cached_alignment = ORIENTATION_UNKNOWN;
+    search_index.reset();
+    ngram_index.reset();
+
+    return complete_rows() - completeRows;
+
+}
+
+size_t _2Dstream::poll(const stream_row_callback& callback)
+{
+    const size_t numNew = refresh(),
+                 end = complete_rows();
+
+    for(size_t y = end - numNew; y < end; ++y)
+    {
+        if(!callback(*this, y))
+        {
+            return y - (end - numNew) + 1;
+        }
+    }
+
+    return numNew;
+}
+
+void _2Dstream::follow(const stream_row_callback& callback, const float& interval,
+                       const atomic<bool>* stop)
+{
+    size_t numNew, end;
+
+    while(!stop || !*stop)
+    {
+        numNew = refresh();
+        end = complete_rows();
+
+        for(size_t y = end - numNew; y < end; ++y)
+        {
+            if(!callback(*this, y))
+            {
+                return;
+            }
+        }
+
+        if(!numNew)
+        {
+            this_thread::sleep_for(chrono::duration<float>(interval));
+        }
+    }
+}
+
+/*
+    Binary index sidecar.  Layout:
+
+        magic[8] | version | source size | source mtime | source checksum |
+        delimiter | rows | cell bytes | row offsets | row pointers |
+        rowSizes | rowDataSizes | row widths | packed cells
+
+    The checksum covers the first and last STREAM_INDEX_CHECKSUM_SIZE bytes of
+    the source, so a changed file is rejected without reading it in full.
+*/
+
+const static char STREAM_INDEX_MAGIC[8] = { 'H', 'Y', 'P', 'R', 'I', 'D', 'X', '\0' };
+
+uint64_t stream_checksum(const char* mapData,
+                         const string& filename,
+                         const unsigned long long& streamSize)
+{
+    uint64_t output = 14695981039346656037ULL; // FNV-1a
+
+    auto hash = [&](const char* c, const size_t& L, const unsigned long long& offset)
+    {
+        for(size_t i = 0; i < L; ++i)
+        {
+            output = (output ^ uint8_t(c[i])) * 1099511628211ULL;
+        }
+        return true;
+    };
+
+    if(streamSize <= 2*STREAM_INDEX_CHECKSUM_SIZE)
+    {
+        read_stream_range(mapData, filename, 0ULL, streamSize, hash);
+    }
+    else
+    {
+        read_stream_range(mapData, filename, 0ULL, STREAM_INDEX_CHECKSUM_SIZE, hash);
+        read_stream_range(mapData, filename, streamSize - STREAM_INDEX_CHECKSUM_SIZE, streamSize, hash);
+    }
+
+    return output;
+}
+
+bool _2Dstream::saveIndex(const string& path) const
+{
+
+    if(streamFile.empty() || imported || empty())
+    {
+        return false;
+    }
+
+    const string outPath = path.empty() ? streamFile + STREAM_INDEX_SIDECAR_EXT : path;
+    const string tmpPath = outPath + ".tmp" + to_string(getpid());
+
+    FILE* outFILE = fopen(tmpPath.c_str(), "wb");
+    if(!outFILE)
+    {
+        if(verbose) cout << ">> Could not write index sidecar to " << outPath << '\n';
+        return false;
+    }
+
+    uint32_t version = STREAM_INDEX_VERSION;
+    uint64_t sourceSize = streamSize;
+    int64_t sourceTime = boost::filesystem::last_write_time(streamFile);
+    uint64_t checksum = stream_checksum(mapping ? mapping->data() : nullptr, streamFile, streamSize);
+
+    fwrite(STREAM_INDEX_MAGIC, 1, sizeof(STREAM_INDEX_MAGIC), outFILE);
+    writeData(version, outFILE);
+    writeData(sourceSize, outFILE);
+    writeData(sourceTime, outFILE);
+    writeData(checksum, outFILE);
+    writeString(delim, outFILE);
+    writeData((uint64_t)nrow(), outFILE);
+    writeData((uint64_t)cellIndex.cellData.size(), outFILE);
+
+    fwrite(cellIndex.rowOffsets.data(), sizeof(uint64_t), nrow(), outFILE);
+    fwrite(cellIndex.rowPointers.data(), sizeof(uint64_t), nrow(), outFILE);
+    fwrite(rowSizes.data(), sizeof(unsigned int), nrow(), outFILE);
+    fwrite(rowDataSizes.data(), sizeof(unsigned int), nrow(), outFILE);
+    fwrite(cellIndex.rowWidths.data(), sizeof(uint8_t), nrow(), outFILE);
+    fwrite(cellIndex.cellData.data(), sizeof(uint8_t), cellIndex.cellData.size(), outFILE);
+
+    bool success = !ferror(outFILE);
+    fclose(outFILE);
+
+    if(!success || ::rename(tmpPath.c_str(), outPath.c_str()))
+    {
+        ::remove(tmpPath.c_str());
+        return false;
+    }
+
+    return true;
+
+}
+
+bool _2Dstream::loadIndex(const string& path, const string& delim)
+{
+
+    if(streamFile.empty())
+    {
+        return false;
+    }
+
+    const string inPath = path.empty() ? streamFile + STREAM_INDEX_SIDECAR_EXT : path;
+
+    if(access(inPath.c_str(), F_OK))
+    {
+        return false;
+    }
+
+    stream_map sidecar(inPath);
+    if(!sidecar.valid())
+    {
+        return false;
+    }
+
+    const char* c = sidecar.data();
+    const char* end = c + sidecar.size();
+
+    auto read = [&](void* output, const size_t& L)
+    {
+        if(c + L > end) return false;
+        memcpy(output, c, L);
+        c += L;
+        return true;
+    };
+
+    char magic[sizeof(STREAM_INDEX_MAGIC)];
+    uint32_t version;
+    uint64_t sourceSize, checksum, cellBytes, rows, delimSize;
+    int64_t sourceTime;
+
+    if(!read(magic, sizeof(magic)) || memcmp(magic, STREAM_INDEX_MAGIC, sizeof(magic)) ||
+       !read(&version, sizeof(version)) || (version != STREAM_INDEX_VERSION) ||
+       !read(&sourceSize, sizeof(sourceSize)) || (sourceSize != streamSize) ||
+       !read(&sourceTime, sizeof(sourceTime)) ||
+       (sourceTime != (int64_t)boost::filesystem::last_write_time(streamFile)) ||
+       !read(&checksum, sizeof(checksum)) ||
+       !read(&delimSize, sizeof(delimSize)) || (c + delimSize > end))
+    {
+        return false;
+    }
+
+    string indexDelim(c, delimSize);
+    c += delimSize;
+
+    if(!delim.empty() && (delim != indexDelim))
+    {
+        return false;
+    }
+
+    if(!read(&rows, sizeof(rows)) || !read(&cellBytes, sizeof(cellBytes)) ||
+       (size_t(end - c) != rows*(2*sizeof(uint64_t) + 2*sizeof(unsigned int) + sizeof(uint8_t)) + cellBytes) ||
+       (checksum != stream_checksum(mapping ? mapping->data() : nullptr, streamFile, streamSize)))
+    {
+        return false;
+    }
+
+    // Bulk copies only; the sidecar is not guaranteed to be aligned
+
+    cellIndex.rowOffsets.resize(rows);
+    cellIndex.rowPointers.resize(rows);
+    rowSizes.resize(rows);
+    rowDataSizes.resize(rows);
+    cellIndex.rowWidths.resize(rows);
+    cellIndex.cellData.resize(cellBytes);
+
+    read(cellIndex.rowOffsets.data(), rows*sizeof(uint64_t));
+    read(cellIndex.rowPointers.data(), rows*sizeof(uint64_t));
+    read(rowSizes.data(), rows*sizeof(unsigned int));
+    read(rowDataSizes.data(), rows*sizeof(unsigned int));
+    read(cellIndex.rowWidths.data(), rows*sizeof(uint8_t));
+    read(cellIndex.cellData.data(), cellBytes);
+
+    for(size_t y = 0; y < rows; ++y)
+    {
+        const uint8_t& width = cellIndex.rowWidths[y];
+        if(((width != 1) && (width != 2) && (width != 4) && (width != 8)) ||
+           (cellIndex.rowPointers[y] + 2*uint64_t(rowSizes[y])*width > cellBytes))
+        {
+            reset_index();
+            return false;
+        }
+    }
+
+    this->delim = indexDelim;
+    numRows = rows;
+    numColumns = rowSizes.empty() ? 0 : max(rowSizes);
+    columnCache.assign(numColumns, nullptr);
+
+    return true;
+
+}
+
+void _2Dstream::reset_index()
+{
+    numRows = 0;
+    numColumns = 0;
+    rowSizes.clear();
+    rowDataSizes.clear();
+    cellIndex.clear();
+    columnCache.clear();
+}
+
+/*
+    Column cache.  Spilled columns are stored as:
+
+        magic[8] | version | source size | source mtime | rows | valid count |
+        values | validity bitmap
+*/
+
+const static char STREAM_COLUMN_MAGIC[8] = { 'H', 'Y', 'P', 'R', 'C', 'O', 'L', '\0' };
+
+void stream_column::set(const size_t& i, const double& value)
+{
+    if(!valid(i)) ++numValid;
+    validity[i >> 6] |= uint64_t(1) << (i & 63);
+    values[i] = value;
+}
+
+void stream_column::getValues(vector<float>& output) const
+{
+    output.insert(output.end(), values.begin(), values.end());
+}
+
+void stream_column::getValidValues(vector<float>& output) const
+{
+    output.reserve(output.size() + numValid);
+    for(size_t i = 0; i < values.size(); ++i)
+    {
+        if(valid(i)) output.push_back(values[i]);
+    }
+}
+
+bool stream_column::save(const string& path, const uint64_t& sourceSize, const int64_t& sourceTime) const
+{
+    const string tmpPath = path + ".tmp" + to_string(getpid());
+
+    FILE* outFILE = fopen(tmpPath.c_str(), "wb");
+    if(!outFILE)
+    {
+        return false;
+    }
+
+    uint32_t version = STREAM_COLUMN_VERSION;
+
+    fwrite(STREAM_COLUMN_MAGIC, 1, sizeof(STREAM_COLUMN_MAGIC), outFILE);
+    writeData(version, outFILE);
+    writeData(sourceSize, outFILE);
+    writeData(sourceTime, outFILE);
+    writeData((uint64_t)values.size(), outFILE);
+    writeData((uint64_t)numValid, outFILE);
+    fwrite(values.data(), sizeof(double), values.size(), outFILE);
+    fwrite(validity.data(), sizeof(uint64_t), validity.size(), outFILE);
+
+    bool success = !ferror(outFILE);
+    fclose(outFILE);
+
+    if(!success || ::rename(tmpPath.c_str(), path.c_str()))
+    {
+        ::remove(tmpPath.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+bool stream_column::load(const string& path, const uint64_t& sourceSize, const int64_t& sourceTime)
+{
+    FILE* inFILE = fopen(path.c_str(), "rb");
+    if(!inFILE)
+    {
+        return false;
+    }
+
+    char magic[sizeof(STREAM_COLUMN_MAGIC)];
+    uint32_t version;
+    uint64_t inSize, rows, inValid;
+    int64_t inTime;
+
+    bool success = (fread(magic, 1, sizeof(magic), inFILE) == sizeof(magic)) &&
+                   !memcmp(magic, STREAM_COLUMN_MAGIC, sizeof(magic)) &&
+                   (fread(&version, sizeof(version), 1, inFILE) == 1) && (version == STREAM_COLUMN_VERSION) &&
+                   (fread(&inSize, sizeof(inSize), 1, inFILE) == 1) && (inSize == sourceSize) &&
+                   (fread(&inTime, sizeof(inTime), 1, inFILE) == 1) && (inTime == sourceTime) &&
+                   (fread(&rows, sizeof(rows), 1, inFILE) == 1) && (rows == values.size()) &&
+                   (fread(&inValid, sizeof(inValid), 1, inFILE) == 1) && (inValid <= rows) &&
+                   (fread(values.data(), sizeof(double), values.size(), inFILE) == values.size()) &&
+                   (fread(validity.data(), sizeof(uint64_t), validity.size(), inFILE) == validity.size());
+
+    fclose(inFILE);
+
+    numValid = success ? inValid : 0;
+    return success;
+}
+
+string _2Dstream::column_path(const unsigned int& col) const
+{
+    return streamFile + ".c" + to_string(col) + STREAM_COLUMN_EXT;
+}
+
+shared_ptr<const stream_column> _2Dstream::getColumnCache(const unsigned int& col) const
+{
+    return col < columnCache.size() ? atomic_load(&columnCache[col]) : nullptr;
+}
+
+shared_ptr<const stream_column> _2Dstream::cacheColumn(const unsigned int& col) const
+{
+
+    if(col >= columnCache.size())
+    {
+        throw out_of_range("_2Dstream::cacheColumn(): column " + to_string(col) + " is out of range");
+    }
+
+    shared_ptr<const stream_column> output = atomic_load(&columnCache[col]);
+    if(output)
+    {
+        return output;
+    }
+
+    lock_guard<mutex> lock(cacheMutex);
+
+    output = atomic_load(&columnCache[col]); // Built by another thread while waiting
+    if(output)
+    {
+        return output;
+    }
+
+    shared_ptr<stream_column> column = make_shared<stream_column>(nrow());
+
+    if(imported || !column->load(column_path(col), streamSize, boost::filesystem::last_write_time(streamFile)))
+    {
+        column = make_shared<stream_column>(nrow());
+
+        vector<string_view> cells;
+        viewCol(cells, col);
+
+        double value;
+        for(size_t y = 0, i = 0; y < nrow(); ++y)
+        {
+            if(col >= rowSize(y)) continue;
+            if(parse_double(cells[i++], value))
+            {
+                column->set(y, value);
+            }
+        }
+    }
+
+    output = column;
+    atomic_store(&columnCache[col], output);
+
+    return output;
+
+}
+
+bool _2Dstream::spillColumn(const unsigned int& col, const bool& release)
+{
+    if(imported || streamFile.empty())
+    {
+        return false;
+    }
+
+    if(!cacheColumn(col)->save(column_path(col), streamSize, boost::filesystem::last_write_time(streamFile)))
+    {
+        if(verbose) cout << ">> Could not spill column " << col << " to " << column_path(col) << '\n';
+        return false;
+    }
+
+    if(release)
+    {
+        releaseColumn(col);
+    }
+
+    return true;
+}
+
+void _2Dstream::releaseColumn(const unsigned int& col)
+{
+    if(col < columnCache.size())
+    {
+        atomic_store(&columnCache[col], shared_ptr<const stream_column>());
+    }
+}
+
+void _2Dstream::clearColumnCache()
+{
+    for(size_t i = 0; i < columnCache.size(); ++i)
+    {
+        releaseColumn(i);
+    }
+}
+
+vector<uint32_t> _2Dstream::getRowIndexSizes(const unsigned int& row) const
+{
+    vector<uint32_t> output(rowSize(row));
+    for(size_t x = 0; x < output.size(); ++x)
+    {
+        output[x] = cellIndex.size_of(x, row);
+    }
+    return output;
+}
+
+vector<uint64_t> _2Dstream::getRowIndexPos(const unsigned int& row) const
+{
+    vector<uint64_t> output(rowSize(row));
+    for(size_t x = 0; x < output.size(); ++x)
+    {
+        output[x] = cellIndex.position(x, row);
+    }
+    return output;
+}
+
+unsigned int _2Dstream::maxRowSize() const noexcept
+{
+    return max(rowSizes);
+}
+
+size_t _2Dstream::getCharCount(const string& chars) const
+{
+
+    if(mapping)
+    {
+        return count_chars(mapping->data(), streamSize, chars.c_str());
+    }
+
+    char* buffer = scan_buffer();
+    size_t output = 0;
+
+    for(unsigned long long coord = 0, bufferSize; coord < streamSize; coord += bufferSize)
+    {
+        bufferSize = STREAM_SCAN_BUFFER_SIZE > streamSize - coord ? streamSize - coord : STREAM_SCAN_BUFFER_SIZE;
+        bufferSize = read_stream(stream, buffer, coord, bufferSize);
+        if(!bufferSize) break;
+
+        output += count_chars(buffer, bufferSize, chars.c_str());
+    }
+
+    return output;
+
+}
+
+unsigned int _2Dstream::colSize(const unsigned int& col) const
+{
+    unsigned int output = 0;
+    for(auto& row : rowSizes)
+    {
+        if(col < row)
+        {
+            ++output;
+        }
+    }
+
+    return output;
+}
+
+Vector2u _2Dstream::locate(const unsigned long long& offset) const
+{
+
+    if(empty() || cellIndex.empty())
+    {
+        return Vector2u(UINT_MAX, UINT_MAX);
+    }
+
+    // Binary search for the last row beginning at or before the offset
+
+    size_t lower = 0, upper = nrow(), mid;
+    while(upper - lower > 1)
+    {
+        mid = (lower + upper)/2;
+        if(rowSize(mid) && (cellIndex.row_offset(mid) > offset))
+        {
+            upper = mid;
+        }
+        else
+        {
+            lower = mid;
+        }
+    }
+
+    for(int x = int(rowSize(lower)) - 1; x >= 0; --x)
+    {
+        if(cellIndex.position(x, lower) <= offset)
+        {
+            return Vector2u(x, lower);
+        }
+    }
+
+    return Vector2u(UINT_MAX, UINT_MAX);
+
+}
+
+const char* _2Dstream::get(const unsigned int& x, const unsigned int& y) const
+{
+    return read_cell(mapping.get(), stream, cellIndex.position(x, y), cellIndex.size_of(x, y));
+}
+
+_1Dstream _2Dstream::getCol(const unsigned int& col) const
+{
+    return _1Dstream(*this, col, false);
+}
+
+size_t _2Dstream::column_index(const string& header) const
+{
+
+    if(nrow() < 1)
+    {
+        throw out_of_range("_2Dstream::column_index(): requested on empty stream");
+    }
+
+    for(size_t i = 0; i < rowSize(0); ++i)
+    {
+        if(getString(i, 0) == header)
+        {
+            return i;
+        }
+    }
+
+    throw out_of_range("_2Dstream::column_index(): header \"" + header + "\" does not exist");
+
+}
+
+size_t _2Dstream::row_index(const string& row_name) const
+{
+
+    if(empty() || (ncol() < 1))
+    {
+        throw out_of_range("_2Dstream::row_index(): requested on empty stream");
+    }
+
+    for(size_t i = 0, L = nrow(); i < L; ++i)
+    {
+        if(getString(0, i) == row_name)
+        {
+            return i;
+        }
+    }
+
+    throw out_of_range("_2Dstream::row_index(): row_name \"" + row_name + "\" does not exist");
+
+}
+
+void _2Dstream::importCol(StringVector& storage, const unsigned int& col) const
+{
+    storage.reserve(storage.size() + numRows);
+    if(!imported)
+    {
+        vector<string_view> views;
+        viewCol(views, col);
+        storage.insert(storage.end(), views.begin(), views.end());
+    }
+    else
+    {
+        for(size_t i = 0; i < nrow(); ++i)
+        {
+            if(col >= rowSizes[i]) continue;
+            storage.push_back(importData[i][col]);
+        }
+    }
+}
+
+void _2Dstream::importRow(StringVector& storage, const unsigned int& row) const
+{
+    if(!imported)
+    {
+        vector<string_view> views;
+        viewRow(views, row);
+        storage.insert(storage.end(), views.begin(), views.end());
+    }
+    else
+    {
+        storage = importData[row];
+    }
+}
+
+void _2Dstream::import()
+{
+    if(imported) update();
+
+    importData.clear();
+    importData.resize(numRows);
+    for(size_t i = 0; i < numRows; ++i)
+    {
+        importRow(importData[i], i);
+        if(verbose) cout << "\r>> Importing stream: " << i*100/numRows << "%";
+    }
+    if(verbose) cout << ">> Importing stream: 100%\n";
+    imported = true;
+
+    fclose(stream);
+    stream = nullptr;
+    mapping.reset();
+    delete[] readBuffer;
+    readBuffer = nullptr;
+    cellIndex.clear();
+}
+
+void _2Dstream::release()
+{
+    if(verbose) cout << ">> Releasing stream data ... ";
+    imported = false;
+    importData.clear();
+
+    readBuffer = new char[STREAM_SCAN_BUFFER_SIZE];
+    const string filename = streamFile; // Cleared on reset
+    openStream(filename, true, delim, bMapped);
+    update();
+    if(verbose) cout << "complete\n";
+}
+
+string _2Dstream::getString(const unsigned int& x, const unsigned int& y) const
+{
+    if(mapping)
+    {
+        string s(mapping->at(cellIndex.position(x, y)), cellIndex.size_of(x, y));
+        processString(s);
+        return s;
+    }
+    else if(!imported)
+    {
+        string s(get(x, y));
+        processString(s);
+        return s;
+    }
+    else
+    {
+        string s = importData[y][x];
+        processString(s);
+        return s;
+    }
+}
+
+string_view _2Dstream::view(const unsigned int& x, const unsigned int& y) const
+{
+    string_view output;
+    if(imported)
+    {
+        output = importData[y][x];
+    }
+    else if(mapping)
+    {
+        output = string_view(mapping->at(cellIndex.position(x, y)), cellIndex.size_of(x, y));
+    }
+    else
+    {
+        output = string_view(get(x, y), cellIndex.size_of(x, y));
+    }
+
+    processString(output);
+    return output;
+}
+
+void _2Dstream::viewRow(vector<string_view>& output, const unsigned int& row) const
+{
+    viewRect(output, Vector2u(0, row), Vector2u(rowSize(row), row + 1));
+}
+
+void _2Dstream::viewCol(vector<string_view>& output, const unsigned int& col) const
+{
+    if(imported || mapping)
+    {
+        output.reserve(output.size() + nrow());
+        for(size_t y = 0; y < nrow(); ++y)
+        {
+            if(col < rowSize(y)) output.push_back(view(col, y));
+        }
+        return;
+    }
+
+    stream_view_batch batch;
+    for(size_t y = 0; y < nrow(); ++y)
+    {
+        if(col < rowSize(y)) batch.add(cellIndex.position(col, y), cellIndex.size_of(col, y));
+    }
+
+    size_t i = output.size();
+    batch.fill(stream, output);
+    for(; i < output.size(); ++i)
+    {
+        processString(output[i]);
+    }
+}
+
+void _2Dstream::viewRect(vector<string_view>& output, const Vector2u& begin,
+                         const Vector2u& end) const
+{
+    if(imported || mapping)
+    {
+        output.reserve(output.size() + (end.x - begin.x)*(end.y - begin.y));
+        for(size_t y = begin.y; y < end.y; ++y)
+        {
+            for(size_t x = begin.x; x < end.x; ++x)
+            {
+                output.push_back(x < rowSize(y) ? view(x, y) : string_view());
+            }
+        }
+        return;
+    }
+
+    stream_view_batch batch;
+    for(size_t y = begin.y; y < end.y; ++y)
+    {
+        for(size_t x = begin.x; x < end.x; ++x)
+        {
+            if(x < rowSize(y)) batch.add(cellIndex.position(x, y), cellIndex.size_of(x, y));
+            else batch.add(0, 0);
+        }
+    }
+
+    size_t i = output.size();
+    batch.fill(stream, output);
+    for(; i < output.size(); ++i)
+    {
+        processString(output[i]);
+    }
+}
+
+float _2Dstream::getFloat(const unsigned int& x, const unsigned int& y) const
+{
+    float output;
+    if(!imported)
+    {
+        if(x < columnCache.size())
+        {
+            shared_ptr<const stream_column> column = atomic_load(&columnCache[x]);
+            if(column) return (*column)[y];
+        }
+
+        const char* c = mapping ? mapping->at(cellIndex.position(x, y)) : get(x, y);
+        return parse_float(c, c + cellIndex.size_of(x, y), output) ? output : NAN;
+    }
+    else
+    {
+        return parse_float(importData[y][x], output) ? output : NAN;
+    }
+}
+
+_1Dstream _2Dstream::getRow(const unsigned int& row) const
+{
+    return _1Dstream(*this, row, true);
+}
+
+_1Dstream _2Dstream::operator[](const unsigned int& row) const
+{
+    return _1Dstream(*this, row, true);
+}
+
+_2Dstream _2Dstream::operator[](const vector<unsigned int>& rows) const
+{
+    size_t L = rows.size();
+
+    stream_index newIndex;
+    dimArray newRowSizes;
+    dimArray newRowDataSizes;
+
+    newIndex.reserve(L, 0);
+    newRowSizes.reserve(L);
+    newRowDataSizes.reserve(L);
+
+    for(size_t i = 0; i < L; ++i)
+    {
+        newIndex.push_row(cellIndex, rows[i], rowSize(rows[i]));
+        newRowSizes.push_back(rowSize(rows[i]));
+        newRowDataSizes.push_back(0);
+        for(size_t x = 0; x < newRowSizes.back(); ++x)
+        {
+            newRowDataSizes.back() += cellIndex.size_of(x, rows[i]);
+        }
+    }
+
+    return _2Dstream(streamFile, newIndex, newRowSizes, newRowDataSizes, "");
+}
+
+_2Dstream _2Dstream::operator[](const VectorPairU& bounds) const
+{
+
+    size_t L = bounds.y.size();
+
+    stream_index newIndex;
+    dimArray newRowSizes;
+    dimArray newRowDataSizes;
+    vector<uint64_t> positions, sizes;
+
+    newIndex.reserve(L, 0);
+    newRowSizes.reserve(L);
+    newRowDataSizes.reserve(L);
+
+    for(size_t i = 0; i < L; ++i)
+    {
+        positions.clear();
+        sizes.clear();
+        for(auto& x : bounds.x)
+        {
+            if(x < rowSize(bounds.y[i]))
+            {
+                positions.push_back(cellIndex.position(x, bounds.y[i]));
+                sizes.push_back(cellIndex.size_of(x, bounds.y[i]));
+            }
+        }
+
+        newIndex.push_row(positions.data(), sizes.data(), positions.size());
+        newRowSizes.push_back(positions.size());
+        newRowDataSizes.push_back(sum(sizes));
+    }
+
+    return _2Dstream(streamFile, newIndex, newRowSizes, newRowDataSizes, "");
+}
+
+void _2Dstream::search_exact(vector<unsigned long long>& output, const string& target,
+                             const unsigned long long& maxCellSize, const bool& bFirst) const
+{
+
+    const size_t L = target.size();
+    if(!L || (L > streamSize))
+    {
+        return;
+    }
+
+    vector<size_t> char_table;
+    vector<size_t> match_table;
+
+    boyer_moore_char_table(target, char_table, true);
+    boyer_moore_match_table(target, match_table, true);
+
+    unsigned int numChunks = 1;
+    if(streamSize >= STREAM_PARALLEL_SEARCH_MIN_SIZE)
+    {
+        numChunks = numThreads ? numThreads : thread::hardware_concurrency();
+        if(!numChunks) numChunks = 1;
+    }
+
+    vector<vector<unsigned long long>> matches(numChunks);
+    atomic<bool> bFound(false);
+
+    // Each chunk owns the matches beginning in its range, and reads L - 1 bytes
+    // past its end so that matches straddling a boundary are found exactly once
+
+    auto search_chunk = [&](const size_t& k)
+    {
+        const unsigned long long begin = streamSize*k/numChunks,
+                                 end = streamSize*(k+1)/numChunks;
+
+        vector<char> buffer(mapping ? 0 : STREAM_SCAN_BUFFER_SIZE + L);
+        const char* data;
+        size_t dataSize, pos, matchCheck;
+
+        for(unsigned long long window = begin, limit; window < end; window = limit)
+        {
+            limit = end - window < STREAM_SCAN_BUFFER_SIZE ? end : window + STREAM_SCAN_BUFFER_SIZE;
+            dataSize = (limit + L - 1 < streamSize ? limit + L - 1 : streamSize) - window;
+
+            if(mapping)
+            {
+                data = mapping->at(window);
+            }
+            else
+            {
+                dataSize = read_stream(stream, buffer.data(), window, dataSize);
+                data = buffer.data();
+            }
+
+            pos = 0;
+            while((pos + L <= dataSize) && (window + pos < limit) &&
+                  ((matchCheck = boyer_moore_search(target.c_str(), data + pos, dataSize - pos,
+                                                    char_table, match_table, true)) != UINT_MAX))
+            {
+                pos += matchCheck;
+                if(window + pos >= limit) break;
+
+                Vector2u coords = locate(window + pos);
+                if((coords.y != UINT_MAX) && (size_of(coords.x, coords.y) <= maxCellSize))
+                {
+                    matches[k].push_back(window + pos);
+                    if(bFirst)
+                    {
+                        bFound = true;
+                        return;
+                    }
+                }
+
+                pos += bFirst ? 1 : L; // Roll forward past this match
+            }
+
+            if(bFirst && bFound) return;
+        }
+    };
+
+    if(numChunks == 1)
+    {
+        search_chunk(0);
+    }
+    else
+    {
+        vector<thread> workers;
+        for(size_t k = 0; k < numChunks; ++k)
+        {
+            workers.emplace_back(search_chunk, k);
+        }
+        for(auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    for(auto& chunk : matches)
+    {
+        output.insert(output.end(), chunk.begin(), chunk.end());
+    }
+
+}
+
+bool _2Dstream::check(const string& target, const float& size_threshold,
+                      const float& match_threshold) const
+{
+
+    // Use the pre-assembled search index if available
+
+    if(search_index && (match_threshold == 1.0f))
+    {
+        return lookup_index(target, nullptr);
+    }
+
+    // Case-insensitive Boyer-Moore search
+
+    if(!imported)
+    {
+
+        if(match_threshold == 1.0f)
+        {
+
+            vector<uint32_t> candidates;
+
+            if(ngram_index && lookup_ngrams(target, 0, candidates))
+            {
+                VectorPairU matches;
+                ngram_exact_matches(*this, *ngram_index, candidates, target,
+                                    target.size()/size_threshold, true, matches);
+                return !matches.empty();
+            }
+
+            vector<unsigned long long> matches;
+            search_exact(matches, target, target.size()/size_threshold, true);
+
+            return !matches.empty();
+
+        }
+        else
+        {
+
+            // Brute force search for partial string matches
+
+            size_t L = target.size();
+
+            unsigned long long coord = 0;
+            unsigned long long bufferPos = 0;
+
+            unsigned int matchCoord = 0;
+            unsigned int initCoord = 0;
+            unsigned int sizeFactor = L/size_threshold;
+            unsigned int matchFactor = L*match_threshold;
+            unsigned int bufferSize = 0;
+
+            char* buffer = scan_buffer();
+            const char* c = buffer;
+
+            // Initialize the trim
+
+            while(matchCoord < L)
+            {
+                if(isSpecial(target[matchCoord])) ++matchCoord;
+                else
+                {
+                    initCoord = matchCoord;
+                    matchCoord = L-1;
+                    break;
+                }
+            }
+
+            while(matchCoord > initCoord + 1)
+            {
+                if(isSpecial(target[matchCoord]))
+                {
+                    --L;
+                    --matchCoord;
+                }
+                else
+                {
+                    break;
+                }
+            }
+
+            L-= initCoord;
+            if(L < 1) L = target.size();
+            if(initCoord >= L-1) initCoord = 0;
+
+            if(L > streamSize) return false;
+            size_t S = streamSize - L + 1;
+
+            matchCoord = initCoord;
+
+            if(mapping)
+            {
+                c = mapping->data(); // Scan the mapped pages directly
+                bufferPos = streamSize;
+            }
+
+            // Perform the search
+
+            for(; coord < S; ++coord)
+            {
+                if(bufferPos <= coord)
+                {
+                    bufferSize = STREAM_SCAN_BUFFER_SIZE > streamSize - coord ? streamSize - coord : STREAM_SCAN_BUFFER_SIZE;
+                    bufferPos += bufferSize;
+                    read_stream(stream, buffer, coord, bufferSize);
+                    c = buffer;
+                }
+
+                if(*c == target[matchCoord])
+                {
+                    ++matchCoord;
+                }
+                else if(isLowerCase(*c))
+                {
+                    if((*c - 32) == target[matchCoord])
+                    {
+                        ++matchCoord;
+                    }
+                }
+                else if(isUpperCase(*c))
+                {
+                    if((*c + 32) == target[matchCoord])
+                    {
+                        ++matchCoord;
+                    }
+                }
+                else if(matchCoord >= matchFactor)
+                {
+                    if((mapping ? mapped_cell_size(mapping->data(), mapping->data() + streamSize, c, delim) :
+                                  getStrSize((char*)c)) <= sizeFactor)
+                    {
+                        return true;
+                    }
+                    matchCoord = initCoord;
+                }
+                else matchCoord = initCoord;
+                ++c;
+            }
+        }
+
+    }
+    else
+    {
+        size_t sizeFactor = target.size()/size_threshold;
+        for(const auto& y : importData)
+        {
+            for(const auto& x : y)
+            {
+                if((sizeFactor > x.size()) && cmpString(target, x)) return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+bool _2Dstream::find(VectorPairU& output, const string& target, const float& size_threshold,
+                     const float& match_threshold)
+{
+
+    if(target.empty())
+    {
+        return false;
+    }
+
+    // Use the pre-assembled search index if available
+
+    if(search_index && (match_threshold == 1.0f))
+    {
+        return lookup_index(target, &output);
+    }
+
+    unsigned int initSIZE = output.size();
+
+    // If all else fails, perform a linear string search
+
+    if(!imported)
+    {
+
+        if(match_threshold == 1.0f)
+        {
+
+            vector<uint32_t> candidates;
+
+            if(ngram_index && lookup_ngrams(target, 0, candidates))
+            {
+
+                // Search only the cells holding every trigram of the target
+
+                ngram_exact_matches(*this, *ngram_index, candidates, target,
+                                    target.size()/size_threshold, false, output);
+
+                return output.size() > initSIZE;
+            }
+
+            // Case-insensitive Boyer-Moore search for exact length matches
+
+            vector<unsigned long long> matches;
+            search_exact(matches, target, target.size()/size_threshold, false);
+
+            for(auto& match : matches)
+            {
+                output.emplace_back(locate(match));
+            }
+
+        }
+        else
+        {
+
+            // Brute force search for partial string matches
+
+            size_t L = target.size();
+
+            unsigned long long coord = 0;
+            unsigned long long bufferPos = 0;
+
+            unsigned int matchCoord = 0;
+            unsigned int initCoord = 0;
+
+            unsigned int bufferSize = 0;
+
+            const char* c = readBuffer;
+
+            // Initialize the trim
+
+            while((matchCoord < L) && (L > 0))
+            {
+                if(isSpecial(target[matchCoord]))
+                {
+                    ++matchCoord;
+                    --L;
+                }
+                else
+                {
+                    initCoord = matchCoord;
+                    matchCoord = L-1;
+                    break;
+                }
+            }
+
+            while((matchCoord > initCoord + 1) && (L > 0))
+            {
+                if(isSpecial(target[matchCoord]))
+                {
+                    --L;
+                    --matchCoord;
+                }
+                else
+                {
+                    break;
+                }
+            }
+
+            L-= initCoord;
+            if(L < 1) L = target.size();
+            if(initCoord >= L-1) initCoord = 0;
+
+            if(L > streamSize) return false;
+            size_t S = streamSize - L + 1;
+
+            matchCoord = initCoord;
+
+            unsigned int sizeFactor;
+            if(L > 3) sizeFactor = L/size_threshold;
+            else sizeFactor = L;
+
+            unsigned int matchFactor;
+            if(L > 3) matchFactor = L*match_threshold;
+            else matchFactor = L;
+
+            vector<uint32_t> candidates;
+
+            if(ngram_index && lookup_ngrams(target.substr(initCoord, L), L - matchFactor, candidates))
+            {
+
+                // Score only the cells sharing enough trigrams with the target
+
+                for(auto& cell : candidates)
+                {
+                    Vector2u coords = ngram_index->coords(cell);
+                    if((size_of(coords.x, coords.y) <= sizeFactor) &&
+                       fuzzy_cell_match(view(coords.x, coords.y), target, initCoord, matchFactor))
+                    {
+                        output.emplace_back(coords);
+                    }
+                }
+
+                return output.size() > initSIZE;
+            }
+
+            fseek(stream, 0, SEEK_SET);
+
+            if(mapping)
+            {
+                c = mapping->data(); // Scan the mapped pages directly
+                bufferPos = streamSize;
+            }
+
+            // Perform the search
+
+            if(!L) return false;
+
+            for(; coord < S; ++coord)
+            {
+
+                if(bufferPos <= coord)
+                {
+                    bufferSize = STREAM_SCAN_BUFFER_SIZE > streamSize - coord ? streamSize - coord : STREAM_SCAN_BUFFER_SIZE;
+                    bufferPos += bufferSize;
+                    fread(readBuffer, 1, bufferSize, stream);
+                    c = readBuffer;
+                }
+
+                if(*c == target[matchCoord])
+                {
+                    ++matchCoord;
+                }
+                else if(isLowerCase(*c))
+                {
+                    if((*c - 32) == target[matchCoord])
+                    {
+                        ++matchCoord;
+                    }
+                }
+                else if(isUpperCase(*c))
+                {
+                    if((*c + 32) == target[matchCoord])
+                    {
+                        ++matchCoord;
+                    }
+                }
+                else if(matchCoord >= matchFactor)
+                {
+
+                    if((mapping ? mapped_cell_size(mapping->data(), mapping->data() + streamSize, c, delim) :
+                                  getStrSize((char*)c)) <= sizeFactor)
+                    {
+                        output.x.push_back(0);
+                        output.y.push_back(0);
+                        while((output.y.back() < nrow() - 1) && (coord > cellIndex.row_offset(output.y.back()) + rowDataSizes[output.y.back()]))
+                        {
+                            ++output.y.back();
+                        }
+                        while((output.x.back() < rowSize(output.y.back()) - 1) && (coord > cellIndex.position(output.x.back()+1, output.y.back())))
+                        {
+                            ++output.x.back();
+                        }
+                    }
+
+                    matchCoord = initCoord;
+                }
+                else matchCoord = initCoord;
+                ++c;
+            }
+
+        }
+
+    }
+    else
+    {
+        unsigned int xCoord, yCoord = 0;
+        unsigned int sizeFactor = target.size()/size_threshold;
+
+        for(const auto& y : importData)
+        {
+            xCoord = 0;
+            for(const auto& x : y)
+            {
+                if((sizeFactor > x.size()) && cmpString(target, x))
+                {
+                    output.x.push_back(xCoord);
+                    output.y.push_back(yCoord);
+                }
+                ++xCoord;
+            }
+            ++yCoord;
+        }
+    }
+
+    return output.size() > initSIZE;
+
+}
+
+Vector2u _2Dstream::getCoords(const string& target, const float& threshold)
+{
+    VectorPairU coords;
+    find(coords, target);
+
+    size_t outSIZE = coords.size();
+    if(outSIZE < 1) return Vector2u(UINT_MAX,UINT_MAX);
+    if(outSIZE < 2) return Vector2u(coords.x.front(), coords.y.front());
+    size_t L = target.size();
+
+    unsigned int minSizeDiff = L, outIndex = 0;
+
+    for(size_t i = 0; i < outSIZE; ++i)
+    {
+        unsigned int othercmp = charMatchNum(target, get(coords.x[i], coords.y[i]));
+        unsigned int sizecmp = othercmp > L ? othercmp - L : L - othercmp;
+        if(sizecmp < minSizeDiff)
+        {
+            minSizeDiff = sizecmp;
+            outIndex = i;
+        }
+    }
+
+    return Vector2u(coords.x[outIndex], coords.y[outIndex]);
+}
+
+unsigned int _2Dstream::findRow(const string& query,
+                                const float& size_threshold)
+{
+
+    Vector2u best_coords = getCoords(query, size_threshold);
+
+    if(best_coords.y >= nrow())
+    {
+        throw std::out_of_range("_2Dstream::findRow(): query not found in stream");
+    }
+
+    return best_coords.y;
+
+}
+
+unsigned int _2Dstream::findCol(const string& query,
+                                const float& size_threshold)
+{
+
+    Vector2u best_coords = getCoords(query, size_threshold);
+
+    if(best_coords.x >= ncol())
+    {
+        throw std::out_of_range("_2Dstream::findCol(): query not found in stream");
+    }
+
+    return best_coords.x;
+
+}
+
+string _2Dstream::findMatch(const string& target, const float& threshold)
+{
+    VectorPairU coords;
+    find(coords, target, threshold);
+
+    if(coords.empty()) return string();
+
+    size_t outSIZE = coords.size();
+    if(outSIZE < 2) return getString(coords.x.front(), coords.y.front());
+    size_t L = target.size();
+
+    std::vector<std::string> candidates;
+    candidates.reserve(coords.size());
+
+    for(size_t i = 0; i < coords.size(); ++i)
+    {
+        candidates.emplace_back(getString(coords[i]));
+    }
+
+    return getBestStringMatch(target, candidates);
+}
+
+unsigned int _2Dstream::getCount(const string& query, bool exact, const float& threshold)
+{
+    unsigned int output = 0;
+    VectorPairU coords;
+    find(coords, query, threshold);
+
+    size_t L = coords.size();
+
+    if(exact)
+    {
+        for(size_t i = 0; i < L; ++i)
+        {
+            if(getString(coords[i]) == query)
+            {
+                ++output;
+            }
+        }
+    }
+    else
+    {
+        output = coords.size();
+    }
+
+    return output;
+}
+
+bool isNumeric(const _1Dstream& stream, const unsigned int index)
+{
+    const char* c = stream.get(index);
+    float output;
+    return parse_float(c, c + strlen(c), output);
+}
+
+string getMatchingString(const string& query, _2Dstream& stream)
+{
+    VectorPairU coords;
+    stream.find(coords, query);
+    Vector2u matchCoords = getBestStreamMatch(coords, stream, query);
+    return stream.getString(matchCoords.x, matchCoords.y);
+}
+
+Vector2u getBestStreamMatch(VectorPairU& coords,
+                            _2Dstream& stream,
+                            const string& target,
+                            const unsigned char& params,
+                            const float& threshold)
+{
+
+    if(coords.empty()) return Vector2u(UINT_MAX, UINT_MAX);
+
+    size_t outSIZE = coords.size(), L = target.size();
+    unsigned int minSizeDiff = L, outIndex = 0;
+
+    vector<string> candidates;
+
+    if(!stream.isImported())
+    {
+        for(size_t i = 0; i < outSIZE; ++i)
+        {
+            candidates.emplace_back(stream.getString(coords[i]));
+        }
+    }
+    else
+    {
+        for(size_t i = 0; i < outSIZE; ++i)
+        {
+            candidates.emplace_back(stream.importData[coords.y[i]][coords.x[i]]);
+        }
+    }
+
+    unsigned int matchIndex = getMatchingIndex(target, candidates, params, threshold);
+
+    if(matchIndex != UINT_MAX)
+    {
+        return coords[matchIndex];
+    }
+
+    return Vector2u(UINT_MAX, UINT_MAX);
+}
+
+void getBestStreamMatchCoords(VectorPairU& coords, _2Dstream& stream, const string& target)
+{
+    size_t outSIZE = coords.size();
+    if(outSIZE < 2) return;
+    size_t L = target.size();
+
+    vector<string> candidates;
+    for(size_t i = 0; i < outSIZE; ++i)
+    {
+        candidates.emplace_back(stream.getString(coords[i]));
+    }
+
+    unsigned int matchIndex = getMatchingIndex(target, candidates, CMP_STR_DEFAULT | CMP_STR_SW, 0.4);
+
+    if(matchIndex != UINT_MAX)
+    {
+
+        string bestMatch = candidates[matchIndex];
+
+        for(size_t i = 0, j = 0; i < outSIZE; ++j)
+        {
+            if(candidates[j] != bestMatch)
+            {
+                coords.erase(i);
+                --outSIZE;
+            }
+            else ++i;
+        }
+    }
+
+
+}
+
+bool filterStreamMatch(StringVector& prompt, _2Dstream& stream, bool getMatches)
+{
+    for(size_t i = 0; i < prompt.size();)
+    {
+        if(getMatches)
+        {
+            prompt[i] = stream.findMatch(prompt[i]);
+            if(prompt[i].size() < 1) prompt.erase(prompt.begin() + i);
+            else ++i;
+        }
+        else if(!getMatches && !stream.check(prompt[i])) prompt.erase(prompt.begin() + i);
+        else ++i;
+    }
+    return prompt.size() > 0;
+}
+
+bool checkAnyStreamMatch(StringVector& query, _2Dstream& stream, bool getMatches)
+{
+    bool output = false;
+    for(auto& tag : query)
+    {
+        if(getMatches)
+        {
+            string matchStr = stream.findMatch(tag);
+            if(matchStr.size() > 0)
+            {
+                tag = matchStr;
+                output = true;
+            }
+        }
+        else
+        {
+            if(stream.check(tag)) return true;
+        }
+    }
+    return output;
+}
+
+ByteNum assessCoordAlignment(const VectorPairU& coords, _2Dstream& dataSource)
+{
+
+    float orientationX = 0.0f,
+          orientationY = 0.0f,
+          yCTR = (float)dataSource.nrow()/2,
+          xCTR = (float)dataSource.ncol()/2;
+
+    size_t tSIZE = coords.size();
+
+    if(tSIZE < 1) return ORIENTATION_NONE;
+
+    for(size_t i = 0; i < tSIZE; ++i)
+    {
+        orientationX += absolute((float)(coords.x[i]) - xCTR)/dataSource.nrow();
+        orientationY += absolute((float)(coords.y[i]) - yCTR)/dataSource.ncol();
+    }
+
+    orientationX /= numUnique(coords.x);
+    orientationY /= numUnique(coords.y);
+
+    if(orientationX > orientationY) return ORIENTATION_COLUMN; // Horizontal distribution is more diffuse
+    if(orientationY > orientationX) return ORIENTATION_ROW; // Vertical distribution is more diffuse
+
+    return ORIENTATION_NONE;
+}
+
+ByteNum assessCoordAlignment(const VectorPairU& inCoords, const VectorPairU& outCoords)
+{
+    size_t L1 = inCoords.size(), L2 = outCoords.size();
+
+    if((L1 < 1) || (L2 < 1)) return ORIENTATION_NONE;
+
+    size_t xMatch = 0, yMatch = 0;
+
+    for(size_t i = 0; i < L1; ++i)
+    {
+        if(anyEqual(inCoords.x[i], outCoords.x)) ++xMatch;
+        if(anyEqual(inCoords.y[i], outCoords.y)) ++yMatch;
+    }
+
+    if(xMatch > yMatch) return ORIENTATION_ROW;
+    if(yMatch > xMatch) return ORIENTATION_COLUMN;
+
+    return ORIENTATION_NONE;
+}
+
+ByteNum assessCoordAlignment(const VectorPairU& coords)
+{
+    size_t xUnique = numUnique(coords.x);
+    size_t yUnique = numUnique(coords.y);
+
+    if(xUnique > yUnique) return ORIENTATION_ROW;
+    if(yUnique > xUnique) return ORIENTATION_COLUMN;
+
+    return ORIENTATION_NONE;
+}
+
+ByteNum getSearchOrientation(const string& query, _2Dstream& stream)
+{
+    VectorPairU coords;
+    stream.find(coords, query);
+    return assessCoordAlignment(coords, stream);
+}
+
+}
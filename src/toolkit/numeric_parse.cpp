@@ -0,0 +1,324 @@
+/** ////////////////////////////////////////////////////////////////
+
+    *** Hyper C++ - A simplified C++ experience ***
+
+        Yet (another) open source library for C++
+
+        Original Copyright (C) Damian Tran 2019
+
+        By aiFive Technologies, Inc. for developers
+
+    Copying and redistribution of this code is freely permissible.
+    Inclusion of the above notice is preferred but not required.
+
+    This software is provided AS IS without any expressed or implied
+    warranties.  By using this code, and any modifications and
+    variants arising thereof, you are assuming all liabilities and
+    risks that may be thus associated.
+
+////////////////////////////////////////////////////////////////  **/
+
+#include "hyper/toolkit/numeric_parse.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <sstream>
+#include <locale>
+
+#if !(defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define NUMERIC_PARSE_SWAR // Eight digits at a time in a 64-bit word
+#endif
+
+#define NUMERIC_PARSE_MAX_DIGITS    19  // Significant digits that fit in a uint64_t
+#define NUMERIC_PARSE_MAX_EXPONENT  100000
+
+using namespace std;
+
+namespace hyperC
+{
+
+const static double POW10[] =
+{
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/*
+    Decimal decomposition of a number: value = mantissa * 10^exponent.
+    exact is cleared if significant digits beyond the mantissa were dropped.
+*/
+
+struct decimal_parts
+{
+    uint64_t        mantissa;
+    int64_t         exponent;
+    unsigned int    digits;     // Significant digits held in the mantissa
+    bool            negative;
+    bool            exact;
+
+    decimal_parts():
+        mantissa(0),
+        exponent(0),
+        digits(0),
+        negative(false),
+        exact(true) { }
+
+    inline void push(const unsigned int& d, const bool& fraction)
+    {
+        if(digits < NUMERIC_PARSE_MAX_DIGITS)
+        {
+            mantissa = mantissa*10 + d;
+            if(mantissa) ++digits;
+            if(fraction) --exponent;
+        }
+        else
+        {
+            if(d) exact = false;
+            if(!fraction) ++exponent;
+        }
+    }
+};
+
+#if defined NUMERIC_PARSE_SWAR
+
+inline uint64_t read_word(const char* c)
+{
+    uint64_t output;
+    memcpy(&output, c, sizeof(output));
+    return output;
+}
+
+inline bool is_eight_digits(const uint64_t& word)
+{
+    return !(((word + 0x4646464646464646ULL) | (word - 0x3030303030303030ULL)) & 0x8080808080808080ULL);
+}
+
+inline uint32_t parse_eight_digits(uint64_t word)
+{
+    word -= 0x3030303030303030ULL;
+    word = (word * 10) + (word >> 8);
+    word = (((word & 0x000000FF000000FFULL) * 0x000F424000000064ULL) +
+            (((word >> 16) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)) >> 32;
+    return uint32_t(word);
+}
+
+#endif
+
+// Consume a run of digits, returning the number consumed
+
+inline size_t parse_digits(const char*& c, const char* end, decimal_parts& parts, const bool& fraction)
+{
+    const char* begin = c;
+
+#if defined NUMERIC_PARSE_SWAR
+    while((end - c >= 8) && (parts.digits + 8 <= NUMERIC_PARSE_MAX_DIGITS))
+    {
+        const uint64_t word = read_word(c);
+        if(!is_eight_digits(word)) break;
+
+        const bool leading = !parts.mantissa;
+        parts.mantissa = parts.mantissa*100000000ULL + parse_eight_digits(word);
+        if(leading)
+        {
+            for(uint64_t m = parts.mantissa; m; m /= 10) ++parts.digits;
+        }
+        else
+        {
+            parts.digits += 8;
+        }
+        if(fraction) parts.exponent -= 8;
+        c += 8;
+    }
+#endif
+
+    while((c < end) && (*c >= '0') && (*c <= '9'))
+    {
+        parts.push(*c - '0', fraction);
+        ++c;
+    }
+
+    return c - begin;
+}
+
+inline void trim_cell(const char*& begin, const char*& end)
+{
+    while((begin < end) && ((*begin == ' ') || (*begin == '"'))) ++begin;
+    while((end > begin) && ((*(end - 1) == ' ') || (*(end - 1) == '"'))) --end;
+}
+
+bool parse_parts(const char* c, const char* end, decimal_parts& parts)
+{
+    trim_cell(c, end);
+    if(c == end)
+    {
+        return false;
+    }
+
+    if((*c == '-') || (*c == '+'))
+    {
+        parts.negative = *c == '-';
+        ++c;
+    }
+
+    size_t numDigits = parse_digits(c, end, parts, false);
+
+    if((c < end) && (*c == '.'))
+    {
+        ++c;
+        numDigits += parse_digits(c, end, parts, true);
+    }
+
+    if(!numDigits)
+    {
+        return false;
+    }
+
+    if((c < end) && ((*c == 'e') || (*c == 'E')))
+    {
+        ++c;
+
+        bool negative = false;
+        if((c < end) && ((*c == '-') || (*c == '+')))
+        {
+            negative = *c == '-';
+            ++c;
+        }
+
+        if((c == end) || (*c < '0') || (*c > '9'))
+        {
+            return false;
+        }
+
+        int64_t exponent = 0;
+        for(; (c < end) && (*c >= '0') && (*c <= '9'); ++c)
+        {
+            if(exponent < NUMERIC_PARSE_MAX_EXPONENT) exponent = exponent*10 + (*c - '0');
+        }
+
+        parts.exponent += negative ? -exponent : exponent;
+    }
+
+    return c == end;
+}
+
+// Correctly rounded conversion for the cases outside the exact fast path
+
+double parse_fallback(const char* begin, const char* end)
+{
+    trim_cell(begin, end);
+
+    istringstream input(string(begin, end));
+    input.imbue(locale::classic());
+
+    double output = 0.0;
+    input >> output;
+    return output;
+}
+
+bool parse_double(const char* begin, const char* end, double& output)
+{
+    decimal_parts parts;
+    if(!parse_parts(begin, end, parts))
+    {
+        return false;
+    }
+
+    double value;
+
+    if(!parts.mantissa)
+    {
+        value = 0.0;
+    }
+    else if(parts.exact && (parts.exponent == 0))
+    {
+        value = double(parts.mantissa);
+    }
+    else if(parts.exact && (parts.mantissa <= (uint64_t(1) << 53)) &&
+            (parts.exponent >= -22) && (parts.exponent <= 22))
+    {
+        // Both operands are exact doubles, so one IEEE operation rounds correctly
+        value = parts.exponent < 0 ? double(parts.mantissa) / POW10[-parts.exponent] :
+                                     double(parts.mantissa) * POW10[parts.exponent];
+    }
+    else
+    {
+        output = parse_fallback(begin, end);
+        return true;
+    }
+
+    output = parts.negative ? -value : value;
+    return true;
+}
+
+bool parse_float(const char* begin, const char* end, float& output)
+{
+    double value;
+    if(!parse_double(begin, end, value))
+    {
+        return false;
+    }
+
+    output = float(value);
+    return true;
+}
+
+bool parse_int(const char* begin, const char* end, int64_t& output)
+{
+    trim_cell(begin, end);
+    if(begin == end)
+    {
+        return false;
+    }
+
+    bool negative = false;
+    if((*begin == '-') || (*begin == '+'))
+    {
+        negative = *begin == '-';
+        ++begin;
+    }
+
+    if(begin == end)
+    {
+        return false;
+    }
+
+    const uint64_t limit = negative ? uint64_t(INT64_MAX) + 1 : uint64_t(INT64_MAX);
+    uint64_t value = 0;
+
+    for(; begin < end; ++begin)
+    {
+        if((*begin < '0') || (*begin > '9') ||
+           (value > (limit - (*begin - '0'))/10))
+        {
+            return false;
+        }
+        value = value*10 + (*begin - '0');
+    }
+
+    output = negative ? int64_t(0 - value) : int64_t(value);
+    return true;
+}
+
+size_t parse_floats(const string_view* cells, const size_t& L, float* output)
+{
+    size_t numValid = 0;
+    for(size_t i = 0; i < L; ++i)
+    {
+        if(parse_float(cells[i], output[i])) ++numValid;
+        else output[i] = NAN;
+    }
+    return numValid;
+}
+
+size_t parse_doubles(const string_view* cells, const size_t& L, double* output)
+{
+    size_t numValid = 0;
+    for(size_t i = 0; i < L; ++i)
+    {
+        if(parse_double(cells[i], output[i])) ++numValid;
+        else output[i] = NAN;
+    }
+    return numValid;
+}
+
+}
@@ -0,0 +1,729 @@
+/** ////////////////////////////////////////////////////////////////
+
+    *** Hyper C++ - A simplified C++ experience ***
+
+        Yet (another) open source library for C++
+
+        Original Copyright (C) Damian Tran 2019
+
+        By aiFive Technologies, Inc. for developers
+
+    Copying and redistribution of this code is freely permissible.
+    Inclusion of the above notice is preferred but not required.
+
+    This software is provided AS IS without any expressed or implied
+    warranties.  By using this code, and any modifications and
+    variants arising thereof, you are assuming all liabilities and
+    risks that may be thus associated.
+
+////////////////////////////////////////////////////////////////  **/
+
+#include "hyper/toolkit/stream_decoder.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include <unistd.h>
+
+#include "boost/filesystem.hpp"
+#include "zlib.h"
+
+#if defined HYPER_ZSTD
+#include <zstd.h>
+#endif
+
+using namespace std;
+
+namespace hyperC
+{
+
+/*
+    Access point sidecar.  Layout:
+
+        magic[8] | version | codec | source size | source mtime | output size |
+        points | (out | in | bits | window size | window) per point
+*/
+
+const static char STREAM_DECODER_MAGIC[8] = { 'H', 'Y', 'P', 'R', 'B', 'L', 'K', '\0' };
+
+static atomic<uint64_t> decoder_serial(1);
+
+stream_decoder::stream_decoder():
+    codec(STREAM_CODEC_NONE),
+    sourceSize(0),
+    outputSize(0),
+    serial(decoder_serial++) { }
+
+uint8_t stream_decoder::detect(const string& filename)
+{
+    FILE* inFILE = fopen(filename.c_str(), "rb");
+    if(!inFILE)
+    {
+        return STREAM_CODEC_NONE;
+    }
+
+    uint8_t magic[4];
+    const size_t L = fread(magic, 1, sizeof(magic), inFILE);
+    fclose(inFILE);
+
+    if((L >= 2) && (magic[0] == 0x1F) && (magic[1] == 0x8B))
+    {
+        return STREAM_CODEC_GZIP;
+    }
+    if((L == 4) && (magic[0] == 0x28) && (magic[1] == 0xB5) && (magic[2] == 0x2F) && (magic[3] == 0xFD))
+    {
+        return STREAM_CODEC_ZSTD;
+    }
+
+    return STREAM_CODEC_NONE;
+}
+
+bool stream_decoder::open(const string& filename, const string& sidecar)
+{
+    this->filename = filename;
+    codec = detect(filename);
+    points.clear();
+    outputSize = 0;
+    serial = decoder_serial++; // Invalidate blocks cached for a previous source
+
+    if(codec == STREAM_CODEC_NONE)
+    {
+        return false;
+    }
+
+    sourceSize = boost::filesystem::file_size(filename);
+
+    if(!sidecar.empty() && load(sidecar))
+    {
+        return true;
+    }
+
+    bool success = false;
+    switch(codec)
+    {
+        case STREAM_CODEC_GZIP:
+            success = build_gzip();
+            break;
+#if defined HYPER_ZSTD
+        case STREAM_CODEC_ZSTD:
+            success = build_zstd();
+            break;
+#endif
+        default:
+            break;
+    }
+
+    if(!success)
+    {
+        points.clear();
+        outputSize = 0;
+        return false;
+    }
+
+    if(!sidecar.empty())
+    {
+        save(sidecar);
+    }
+
+    return true;
+}
+
+bool stream_decoder::build_gzip()
+{
+
+    FILE* inFILE = fopen(filename.c_str(), "rb");
+    if(!inFILE)
+    {
+        return false;
+    }
+
+    z_stream strm;
+    memset(&strm, 0, sizeof(strm));
+
+    if(inflateInit2(&strm, 47) != Z_OK) // Automatic zlib or gzip header detection
+    {
+        fclose(inFILE);
+        return false;
+    }
+
+    vector<uint8_t> input(STREAM_DECODER_INPUT_SIZE),
+                    window(STREAM_DECODER_WINDOW);
+
+    uint64_t totalIn = 0, totalOut = 0, last = 0;
+    size_t have = 0;    // Write position in the circular window
+    bool full = false;  // Has the window wrapped?
+    int ret = Z_OK;
+
+    while(true)
+    {
+        if(!strm.avail_in)
+        {
+            strm.avail_in = fread(input.data(), 1, input.size(), inFILE);
+            strm.next_in = input.data();
+            if(!strm.avail_in) break;
+        }
+
+        if(ret == Z_STREAM_END)
+        {
+            inflateReset(&strm); // Another gzip member follows
+        }
+
+        strm.next_out = window.data() + have;
+        strm.avail_out = window.size() - have;
+
+        totalIn += strm.avail_in;
+        totalOut += strm.avail_out;
+        ret = inflate(&strm, Z_BLOCK); // Return at the end of every deflate block
+        totalIn -= strm.avail_in;
+        totalOut -= strm.avail_out;
+
+        if((ret == Z_NEED_DICT) || (ret == Z_DATA_ERROR) || (ret == Z_MEM_ERROR))
+        {
+            break; // Trailing garbage after a complete member is ignored
+        }
+
+        have = strm.next_out - window.data();
+        if(have == window.size())
+        {
+            have = 0;
+            full = true;
+        }
+
+        // A point is only possible between deflate blocks, and never after the last block
+
+        if((strm.data_type & 128) && !(strm.data_type & 64) &&
+           (points.empty() || (totalOut - last >= STREAM_DECODER_SPAN)))
+        {
+            points.emplace_back();
+            access_point& point = points.back();
+
+            point.out = totalOut;
+            point.in = totalIn;
+            point.bits = strm.data_type & 7;
+
+            if(full)
+            {
+                point.window.assign(window.begin() + have, window.end());
+                point.window.insert(point.window.end(), window.begin(), window.begin() + have);
+            }
+            else
+            {
+                point.window.assign(window.begin(), window.begin() + have);
+            }
+
+            last = totalOut;
+        }
+    }
+
+    inflateEnd(&strm);
+    fclose(inFILE);
+
+    outputSize = totalOut;
+    return !points.empty() && (ret != Z_MEM_ERROR);
+
+}
+
+bool stream_decoder::decode_gzip(const access_point& point, const uint64_t& begin, const uint64_t& end,
+                                 const stream_block_reader& reader) const
+{
+
+    FILE* inFILE = fopen(filename.c_str(), "rb");
+    if(!inFILE)
+    {
+        return false;
+    }
+
+    z_stream strm;
+    memset(&strm, 0, sizeof(strm));
+
+    if(inflateInit2(&strm, -15) != Z_OK) // Raw deflate from the point onward
+    {
+        fclose(inFILE);
+        return false;
+    }
+
+    bool success = true;
+
+    fseeko(inFILE, point.in - (point.bits ? 1 : 0), SEEK_SET);
+    if(point.bits)
+    {
+        const int c = getc(inFILE);
+        success = (c != EOF) && (inflatePrime(&strm, point.bits, c >> (8 - point.bits)) == Z_OK);
+    }
+    if(success && !point.window.empty())
+    {
+        success = inflateSetDictionary(&strm, point.window.data(), point.window.size()) == Z_OK;
+    }
+
+    vector<uint8_t> input(STREAM_DECODER_INPUT_SIZE),
+                    output(STREAM_DECODER_CHUNK_SIZE);
+
+    uint64_t pos = point.out;
+    size_t skip = 0;    // Trailer bytes of a finished member
+    bool raw = true;
+    int ret = Z_OK;
+
+    while(success && (pos < end))
+    {
+        if(!strm.avail_in)
+        {
+            strm.avail_in = fread(input.data(), 1, input.size(), inFILE);
+            strm.next_in = input.data();
+            if(!strm.avail_in) break;
+        }
+
+        if(skip)
+        {
+            const size_t L = skip < strm.avail_in ? skip : strm.avail_in;
+            strm.next_in += L;
+            strm.avail_in -= L;
+            skip -= L;
+            continue;
+        }
+
+        if(ret == Z_STREAM_END)
+        {
+            // Members after the first are read with their gzip headers and trailers
+
+            if(raw)
+            {
+                if(inflateReset2(&strm, 31) != Z_OK) break;
+                raw = false;
+            }
+            else
+            {
+                inflateReset(&strm);
+            }
+        }
+
+        strm.next_out = output.data();
+        strm.avail_out = output.size();
+        ret = inflate(&strm, Z_NO_FLUSH);
+
+        if((ret == Z_NEED_DICT) || (ret == Z_DATA_ERROR) || (ret == Z_MEM_ERROR) || (ret == Z_STREAM_ERROR))
+        {
+            success = (ret == Z_DATA_ERROR) && !raw && (pos >= outputSize); // Trailing garbage
+            break;
+        }
+
+        const size_t L = output.size() - strm.avail_out;
+        if((pos + L > begin) && L)
+        {
+            const uint64_t first = pos > begin ? pos : begin,
+                           last = pos + L < end ? pos + L : end;
+            if(!reader((const char*)output.data() + (first - pos), last - first, first))
+            {
+                break;
+            }
+        }
+        pos += L;
+
+        if((ret == Z_STREAM_END) && raw)
+        {
+            skip = 8; // CRC-32 and size
+        }
+    }
+
+    inflateEnd(&strm);
+    fclose(inFILE);
+
+    return success;
+
+}
+
+#if defined HYPER_ZSTD
+
+bool stream_decoder::build_zstd()
+{
+
+    FILE* inFILE = fopen(filename.c_str(), "rb");
+    if(!inFILE)
+    {
+        return false;
+    }
+
+    ZSTD_DCtx* ctx = ZSTD_createDCtx();
+    vector<char> input(ZSTD_DStreamInSize()),
+                 output(ZSTD_DStreamOutSize());
+
+    uint64_t totalIn = 0, totalOut = 0, last = 0;
+    bool success = true;
+
+    points.emplace_back();
+    points.back().out = 0;
+    points.back().in = 0;
+    points.back().bits = 0;
+
+    for(size_t L; success && ((L = fread(input.data(), 1, input.size(), inFILE)) > 0); totalIn += L)
+    {
+        ZSTD_inBuffer inBuffer = { input.data(), L, 0 };
+        ZSTD_outBuffer outBuffer = { output.data(), output.size(), output.size() };
+
+        while((inBuffer.pos < inBuffer.size) || (outBuffer.pos == outBuffer.size))
+        {
+            outBuffer.pos = 0;
+            const size_t ret = ZSTD_decompressStream(ctx, &outBuffer, &inBuffer);
+            if(ZSTD_isError(ret))
+            {
+                success = false;
+                break;
+            }
+
+            totalOut += outBuffer.pos;
+
+            // Frames are the only places decompression may resume
+
+            if(!ret && (totalOut - last >= STREAM_DECODER_SPAN))
+            {
+                points.emplace_back();
+                points.back().out = totalOut;
+                points.back().in = totalIn + inBuffer.pos;
+                points.back().bits = 0;
+                last = totalOut;
+            }
+        }
+    }
+
+    ZSTD_freeDCtx(ctx);
+    fclose(inFILE);
+
+    if(points.back().out == totalOut) // Nothing follows the last frame
+    {
+        points.pop_back();
+    }
+
+    outputSize = totalOut;
+    return success && !points.empty();
+
+}
+
+bool stream_decoder::decode_zstd(const access_point& point, const uint64_t& begin, const uint64_t& end,
+                                 const stream_block_reader& reader) const
+{
+
+    FILE* inFILE = fopen(filename.c_str(), "rb");
+    if(!inFILE)
+    {
+        return false;
+    }
+
+    fseeko(inFILE, point.in, SEEK_SET);
+
+    ZSTD_DCtx* ctx = ZSTD_createDCtx();
+    vector<char> input(ZSTD_DStreamInSize()),
+                 output(ZSTD_DStreamOutSize());
+
+    uint64_t pos = point.out;
+    bool success = true, stop = false;
+
+    for(size_t L; !stop && (pos < end) && ((L = fread(input.data(), 1, input.size(), inFILE)) > 0); )
+    {
+        ZSTD_inBuffer inBuffer = { input.data(), L, 0 };
+        ZSTD_outBuffer outBuffer = { output.data(), output.size(), output.size() };
+
+        while(!stop && (pos < end) && ((inBuffer.pos < inBuffer.size) || (outBuffer.pos == outBuffer.size)))
+        {
+            outBuffer.pos = 0;
+            const size_t ret = ZSTD_decompressStream(ctx, &outBuffer, &inBuffer);
+            if(ZSTD_isError(ret))
+            {
+                success = false;
+                stop = true;
+                break;
+            }
+
+            const size_t N = outBuffer.pos;
+            if((pos + N > begin) && N)
+            {
+                const uint64_t first = pos > begin ? pos : begin,
+                               last = pos + N < end ? pos + N : end;
+                stop = !reader(output.data() + (first - pos), last - first, first);
+            }
+            pos += N;
+        }
+    }
+
+    ZSTD_freeDCtx(ctx);
+    fclose(inFILE);
+
+    return success;
+
+}
+
+#endif
+
+bool stream_decoder::decode(const uint64_t& begin, const uint64_t& end, const stream_block_reader& reader) const
+{
+    if(points.empty() || (begin >= end))
+    {
+        return false;
+    }
+
+    auto it = upper_bound(points.begin(), points.end(), begin,
+                          [](const uint64_t& pos, const access_point& point){ return pos < point.out; });
+    const access_point& point = *(it == points.begin() ? it : it - 1);
+
+    switch(codec)
+    {
+        case STREAM_CODEC_GZIP:
+            return decode_gzip(point, begin, end, reader);
+#if defined HYPER_ZSTD
+        case STREAM_CODEC_ZSTD:
+            return decode_zstd(point, begin, end, reader);
+#endif
+        default:
+            return false;
+    }
+}
+
+/*
+    Per-thread cache of the last decompressed block, so that neighbouring
+    cells read one after another cost a single decompression.
+*/
+
+struct stream_decoder_block
+{
+    uint64_t        serial;
+    uint64_t        begin;
+    vector<char>    data;
+
+    stream_decoder_block():
+        serial(0),
+        begin(0) { }
+
+    inline bool holds(const uint64_t& id, const uint64_t& pos) const noexcept
+    {
+        return (serial == id) && (pos >= begin) && (pos < begin + data.size());
+    }
+};
+
+size_t stream_decoder::read(char* output, const unsigned long long& pos, const size_t& L) const
+{
+    thread_local stream_decoder_block block;
+
+    size_t numRead = 0;
+    uint64_t next;
+
+    while((numRead < L) && ((next = pos + numRead) < outputSize))
+    {
+        if(!block.holds(serial, next))
+        {
+            block.serial = 0;
+            block.begin = next - next % STREAM_DECODER_SPAN;
+            block.data.clear();
+
+            const uint64_t blockEnd = block.begin + STREAM_DECODER_SPAN < outputSize ?
+                                          block.begin + STREAM_DECODER_SPAN : outputSize;
+            block.data.reserve(blockEnd - block.begin);
+
+            decode(block.begin, blockEnd, [&](const char* c, const size_t& N, const unsigned long long& offset)
+            {
+                block.data.insert(block.data.end(), c, c + N);
+                return true;
+            });
+
+            block.serial = serial;
+            if(!block.holds(serial, next))
+            {
+                break; // Unreadable source
+            }
+        }
+
+        const size_t N = min<uint64_t>(L - numRead, block.begin + block.data.size() - next);
+        memcpy(output + numRead, block.data.data() + (next - block.begin), N);
+        numRead += N;
+    }
+
+    return numRead;
+}
+
+void stream_decoder::scan(const unsigned long long& begin, const unsigned long long& end,
+                          const stream_block_reader& reader) const
+{
+
+    if(begin >= end)
+    {
+        return;
+    }
+
+    // Two chunks in flight: one being read while the next is decompressed
+
+    mutex queueMutex;
+    condition_variable ready;
+    deque<pair<uint64_t, vector<char>>> chunks;
+    bool finished = false, stopped = false;
+
+    thread producer([&]()
+    {
+        vector<char> chunk;
+        uint64_t chunkPos = begin;
+
+        auto push = [&]()
+        {
+            unique_lock<mutex> lock(queueMutex);
+            ready.wait(lock, [&](){ return (chunks.size() < 2) || stopped; });
+            if(stopped) return false;
+            chunks.emplace_back(chunkPos, move(chunk));
+            chunk = vector<char>();
+            ready.notify_all();
+            return true;
+        };
+
+        decode(begin, end, [&](const char* c, const size_t& L, const unsigned long long& offset)
+        {
+            if(chunk.empty()) chunkPos = offset;
+            chunk.insert(chunk.end(), c, c + L);
+            return (chunk.size() < STREAM_DECODER_CHUNK_SIZE) || push();
+        });
+
+        if(!chunk.empty()) push();
+
+        lock_guard<mutex> lock(queueMutex);
+        finished = true;
+        ready.notify_all();
+    });
+
+    pair<uint64_t, vector<char>> chunk;
+
+    while(true)
+    {
+        {
+            unique_lock<mutex> lock(queueMutex);
+            ready.wait(lock, [&](){ return !chunks.empty() || finished; });
+            if(chunks.empty()) break;
+            chunk = move(chunks.front());
+            chunks.pop_front();
+            ready.notify_all();
+        }
+
+        if(!reader(chunk.second.data(), chunk.second.size(), chunk.first))
+        {
+            lock_guard<mutex> lock(queueMutex);
+            stopped = true;
+            ready.notify_all();
+            break;
+        }
+    }
+
+    producer.join();
+
+}
+
+bool stream_decoder::save(const string& path) const
+{
+
+    if(points.empty())
+    {
+        return false;
+    }
+
+    const string tmpPath = path + ".tmp" + to_string(getpid());
+
+    FILE* outFILE = fopen(tmpPath.c_str(), "wb");
+    if(!outFILE)
+    {
+        return false;
+    }
+
+    uint32_t version = STREAM_DECODER_VERSION;
+    int64_t sourceTime = boost::filesystem::last_write_time(filename);
+    uint64_t numPoints = points.size();
+
+    fwrite(STREAM_DECODER_MAGIC, 1, sizeof(STREAM_DECODER_MAGIC), outFILE);
+    fwrite(&version, sizeof(version), 1, outFILE);
+    fwrite(&codec, sizeof(codec), 1, outFILE);
+    fwrite(&sourceSize, sizeof(sourceSize), 1, outFILE);
+    fwrite(&sourceTime, sizeof(sourceTime), 1, outFILE);
+    fwrite(&outputSize, sizeof(outputSize), 1, outFILE);
+    fwrite(&numPoints, sizeof(numPoints), 1, outFILE);
+
+    uint32_t windowSize;
+    for(auto& point : points)
+    {
+        windowSize = point.window.size();
+        fwrite(&point.out, sizeof(point.out), 1, outFILE);
+        fwrite(&point.in, sizeof(point.in), 1, outFILE);
+        fwrite(&point.bits, sizeof(point.bits), 1, outFILE);
+        fwrite(&windowSize, sizeof(windowSize), 1, outFILE);
+        fwrite(point.window.data(), 1, windowSize, outFILE);
+    }
+
+    bool success = !ferror(outFILE);
+    fclose(outFILE);
+
+    if(!success || ::rename(tmpPath.c_str(), path.c_str()))
+    {
+        ::remove(tmpPath.c_str());
+        return false;
+    }
+
+    return true;
+
+}
+
+bool stream_decoder::load(const string& path)
+{
+
+    FILE* inFILE = fopen(path.c_str(), "rb");
+    if(!inFILE)
+    {
+        return false;
+    }
+
+    char magic[sizeof(STREAM_DECODER_MAGIC)];
+    uint32_t version;
+    uint8_t inCodec;
+    uint64_t inSize, inOutputSize, numPoints;
+    int64_t inTime;
+
+    bool success = (fread(magic, 1, sizeof(magic), inFILE) == sizeof(magic)) &&
+                   !memcmp(magic, STREAM_DECODER_MAGIC, sizeof(magic)) &&
+                   (fread(&version, sizeof(version), 1, inFILE) == 1) && (version == STREAM_DECODER_VERSION) &&
+                   (fread(&inCodec, sizeof(inCodec), 1, inFILE) == 1) && (inCodec == codec) &&
+                   (fread(&inSize, sizeof(inSize), 1, inFILE) == 1) && (inSize == sourceSize) &&
+                   (fread(&inTime, sizeof(inTime), 1, inFILE) == 1) &&
+                   (inTime == (int64_t)boost::filesystem::last_write_time(filename)) &&
+                   (fread(&inOutputSize, sizeof(inOutputSize), 1, inFILE) == 1) &&
+                   (fread(&numPoints, sizeof(numPoints), 1, inFILE) == 1) && (numPoints > 0);
+
+    vector<access_point> inPoints;
+    uint32_t windowSize;
+
+    for(size_t i = 0; success && (i < numPoints); ++i)
+    {
+        inPoints.emplace_back();
+        access_point& point = inPoints.back();
+
+        success = (fread(&point.out, sizeof(point.out), 1, inFILE) == 1) &&
+                  (fread(&point.in, sizeof(point.in), 1, inFILE) == 1) &&
+                  (fread(&point.bits, sizeof(point.bits), 1, inFILE) == 1) && (point.bits < 8) &&
+                  (fread(&windowSize, sizeof(windowSize), 1, inFILE) == 1) &&
+                  (windowSize <= STREAM_DECODER_WINDOW) && (point.in <= sourceSize) &&
+                  (point.out <= inOutputSize) && (!i || (point.out > inPoints[i-1].out));
+
+        if(success)
+        {
+            point.window.resize(windowSize);
+            success = fread(point.window.data(), 1, windowSize, inFILE) == windowSize;
+        }
+    }
+
+    fclose(inFILE);
+
+    if(!success)
+    {
+        return false;
+    }
+
+    points = move(inPoints);
+    outputSize = inOutputSize;
+    return true;
+
+}
+
+}